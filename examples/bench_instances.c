@@ -0,0 +1,151 @@
+/* ----
+ * ---- file   : bench_instances.c
+ * ---- author : bsp
+ * ---- legal  : Distributed under terms of the MIT LICENSE (MIT).
+ * ----
+ * ---- Permission is hereby granted, free of charge, to any person obtaining a copy
+ * ---- of this software and associated documentation files (the "Software"), to deal
+ * ---- in the Software without restriction, including without limitation the rights
+ * ---- to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * ---- copies of the Software, and to permit persons to whom the Software is
+ * ---- furnished to do so, subject to the following conditions:
+ * ----
+ * ---- The above copyright notice and this permission notice shall be included in
+ * ---- all copies or substantial portions of the Software.
+ * ----
+ * ---- THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * ---- IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * ---- FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * ---- AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * ---- LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * ---- OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * ---- THE SOFTWARE.
+ * ----
+ * ---- info   : This is part of the "lglw" package.
+ * ----          Measures lglw_init_ex() time per instance (display cache, see loc_display_cache_ref()).
+ * ----
+ * ----          $ gcc -O2 -I.. -o bench_instances bench_instances.c ../lglw_linux.c -lX11 -lXrender -lXrandr -lXfixes -lXi -lGL -lpthread
+ * ----            (build with -DLGLW_USE_XINPUT2=0 and drop -lXi when libXi is not available, see README.md)
+ * ----          $ ./bench_instances [numInstances] [shared]
+ * ----
+ * ---- created: 16Oct2026
+ * ---- changed:
+ * ----
+ * ----
+ */
+
+#include "lglw.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_INSTANCES  (256)
+
+
+// ---------------------------------------------------------------------------- time_ns
+static uint64_t time_ns(void) {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ((uint64_t)ts.tv_sec * 1000000000ull) + (uint64_t)ts.tv_nsec;
+}
+
+
+// ---------------------------------------------------------------------------- run
+//  Create and destroy 'numInstances' instances, print time per instance
+//   (note) when '_retKeep' is not NULL, the first instance is kept alive and returned to the caller
+static int run(const char *_label, int _numInstances, uint32_t _flags, lglw_t *_retKeep) {
+   static lglw_t instances[MAX_INSTANCES];
+   uint64_t tTotal = 0u;
+   uint64_t tFirst = 0u;
+   int i;
+
+   for(i = 0; i < _numInstances; i++)
+   {
+      uint64_t t = time_ns();
+
+      instances[i] = lglw_init_ex(0, 0, _flags);
+
+      if(NULL == instances[i])
+      {
+         printf("[---] %s: lglw_init_ex() failed (instance %d)\n", _label, i);
+         _numInstances = i;
+         break;
+      }
+
+      // Bind the GL context once, too
+      lglw_glcontext_push(instances[i]);
+      lglw_glcontext_pop(instances[i]);
+
+      t = time_ns() - t;
+
+      if(0 == i)
+         tFirst = t;
+      else
+         tTotal += t;
+
+      printf("%s: instance %3d: %8.3f ms\n", _label, i, t / 1000000.0);
+   }
+
+   if(_numInstances > 1)
+   {
+      printf("%s: first=%.3f ms  avg(others)=%.3f ms\n", _label, tFirst / 1000000.0, (tTotal / (double)(_numInstances - 1)) / 1000000.0);
+   }
+
+   i = 0;
+
+   if( (NULL != _retKeep) && (_numInstances > 0) )
+   {
+      *_retKeep = instances[0];
+      i = 1;
+   }
+
+   for(; i < _numInstances; i++)
+   {
+      lglw_exit(instances[i]);
+   }
+
+   return (_numInstances > 0) ? 0 : 1;
+}
+
+
+// ---------------------------------------------------------------------------- main
+int main(int argc, char **argv) {
+   int numInstances = 8;
+   uint32_t flags = 0u;
+   lglw_t keep = NULL;
+   int r;
+
+   if(argc > 1)
+   {
+      numInstances = atoi(argv[1]);
+
+      if(numInstances < 1)
+         numInstances = 1;
+      else if(numInstances > MAX_INSTANCES)
+         numInstances = MAX_INSTANCES;
+   }
+
+   if( (argc > 2) && (0 == strcmp(argv[2], "shared")) )
+   {
+      flags |= LGLW_INIT_SHARED_DISPLAY;
+   }
+
+   // (note) the first instance of the first pass keeps the display cache entry alive (the cache, and
+   //         the connections parked by exited instances, are freed when the last instance exits).
+   //         the second pass reuses the cache and up to 4 parked connections of the first pass.
+   r = run("pass 1", numInstances, flags, &keep);
+
+   if(0 == r)
+   {
+      r = run("pass 2", numInstances, flags, NULL);
+   }
+
+   if(NULL != keep)
+   {
+      lglw_exit(keep);
+   }
+
+   return r;
+}
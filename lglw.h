@@ -24,7 +24,7 @@
  * ---- info   : This is part of the "lglw" package.
  * ----
  * ---- created: 04Aug2018
- * ---- changed: 05Aug2018, 06Aug2018, 07Aug2018, 08Aug2018, 18Aug2018, 05Sep2018
+ * ---- changed: 05Aug2018, 06Aug2018, 07Aug2018, 08Aug2018, 18Aug2018, 05Sep2018, 16Oct2026
  * ----
  * ----
  */
@@ -40,6 +40,15 @@
 // Opaque library / instance handle
 typedef void *lglw_t;
 
+// Opaque worker GL context handle (see lglw_glcontext_worker_create())
+typedef void *lglw_glworker_t;
+
+// Opaque GL fence handle (see lglw_glfence_insert())
+typedef void *lglw_glfence_t;
+
+// Opaque mouse cursor handle (see lglw_cursor_set())
+typedef void *lglw_cursor_t;
+
 // Boolean type
 #define LGLW_TRUE  (1)
 #define LGLW_FALSE (0)
@@ -76,6 +85,20 @@ typedef struct lglw_vec2i_s {
 #define LGLW_MOUSE_GRAB_NONE     (0u)   // no mouse grab
 #define LGLW_MOUSE_GRAB_CAPTURE  (1u)   // report mouse positions beyond window boundaries (+ show mouse pointer)
 #define LGLW_MOUSE_GRAB_WARP     (2u)   // capture + invisible mouse pointer + warp back to original position when ungrabbed
+#define LGLW_MOUSE_GRAB_RELATIVE (3u)   // invisible, confined mouse pointer. reports unaccelerated motion deltas (see lglw_mouse_relative_callback_set()). Linux only.
+
+// Standard mouse cursor shapes (see lglw_cursor_standard_get())
+#define LGLW_CURSOR_DEFAULT    (0u)  // parent window's cursor (NULL handle)
+#define LGLW_CURSOR_BLANK      (1u)
+#define LGLW_CURSOR_ARROW      (2u)
+#define LGLW_CURSOR_TEXT       (3u)
+#define LGLW_CURSOR_CROSSHAIR  (4u)
+#define LGLW_CURSOR_HAND       (5u)
+#define LGLW_CURSOR_WAIT       (6u)
+#define LGLW_CURSOR_RESIZE_H   (7u)
+#define LGLW_CURSOR_RESIZE_V   (8u)
+#define LGLW_CURSOR_MOVE       (9u)
+#define LGLW_NUM_CURSORS       (10u)
 
 // Focus types
 #define LGLW_FOCUS_MOUSE  (1u << 0)
@@ -145,6 +168,10 @@ typedef struct lglw_vec2i_s {
 // Mouse callback function type
 typedef void (*lglw_mouse_fxn_t) (lglw_t _lglw, int32_t _x, int32_t _y, uint32_t _buttonState, uint32_t _changedButtonState);
 
+// Relative mouse motion callback function type (see LGLW_MOUSE_GRAB_RELATIVE)
+//  'dx' / 'dy' are unaccelerated device deltas (may be fractional)
+typedef void (*lglw_mouse_relative_fxn_t) (lglw_t _lglw, float _dx, float _dy, uint32_t _buttonState);
+
 // Focus callback function type
 typedef void (*lglw_focus_fxn_t) (lglw_t _lglw, uint32_t _focusState, uint32_t _changedFocusState);
 
@@ -156,20 +183,126 @@ typedef lglw_bool_t (*lglw_keyboard_fxn_t) (lglw_t _lglw, uint32_t _vkey, uint32
 // Timer callback function type
 typedef void (*lglw_timer_fxn_t) (lglw_t _lglw);
 
+// Extended timer callback function type (see lglw_timer_add())
+//  'numMissed' is the number of ticks that were skipped since the previous callback (e.g. while the event loop was blocked)
+typedef void (*lglw_timer_ex_fxn_t) (lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData);
+
 // File drag'n'drop callback function type
 typedef void (*lglw_dropfiles_fxn_t) (lglw_t _lglw, int32_t _x, int32_t _y, uint32_t _numFiles, const char**_pathNames);
 
+// Clipboard request status (see lglw_clipboard_fxn_t)
+#define LGLW_CLIPBOARD_OK         (0u)  // data is valid
+#define LGLW_CLIPBOARD_FAILED     (1u)  // no clipboard owner, or owner can't provide the requested type
+#define LGLW_CLIPBOARD_TIMEOUT    (2u)  // owner did not respond in time
+#define LGLW_CLIPBOARD_CANCELLED  (3u)  // see lglw_clipboard_request_cancel()
+#define LGLW_CLIPBOARD_PARTIAL    (4u)  // next chunk of a large (INCR) transfer. followed by more chunks and a final LGLW_CLIPBOARD_OK (with 0 bytes)
+
+// Clipboard request callback function type (see lglw_clipboard_request_async())
+//  (note) data is only valid during the callback
+typedef void (*lglw_clipboard_fxn_t) (lglw_t _lglw, uint32_t _status, const char *_mimeType, const void *_data, uint32_t _numBytes);
+
+// Clipboard content provider function type (see lglw_clipboard_provider_set())
+//  Return: pointer to the content in the requested format, or NULL if it can't be provided. Store size in *_retNumBytes.
+//  (note) the provider may be called several times (per type) while earlier results are still being sent in chunks,
+//          so all returned content must remain valid until the provider is called with mimeType NULL
+//  (note) mimeType NULL: ownership has been lost / replaced (content may be freed). return value is ignored.
+typedef const void *(*lglw_clipboard_provider_fxn_t) (lglw_t _lglw, const char *_mimeType, uint32_t *_retNumBytes);
+
+// Drag source data provider function type (see lglw_drag_begin())
+//  (note) same contract as lglw_clipboard_provider_fxn_t. mimeType NULL: drag has ended (dropped or cancelled).
+typedef lglw_clipboard_provider_fxn_t lglw_drag_provider_fxn_t;
+
 // Redraw function type
 typedef void (*lglw_redraw_fxn_t) (lglw_t _lglw);
 
+// Frame callback function type (see lglw_frame_callback_set())
+//  'presentNS' is the predicted time (CLOCK_MONOTONIC, nanoseconds, see lglw_time_get_ns()) of the
+//  display refresh at which a frame that is rendered now will be shown
+typedef void (*lglw_frame_fxn_t) (lglw_t _lglw, uint64_t _presentNS);
+
+// Event types (see lglw_events_poll())
+#define LGLW_EVENT_NONE            (0u)
+#define LGLW_EVENT_MOUSE           (1u)
+#define LGLW_EVENT_FOCUS           (2u)
+#define LGLW_EVENT_KEYBOARD        (3u)
+#define LGLW_EVENT_MOUSE_RELATIVE  (4u)
+
+// Mouse event (see lglw_mouse_fxn_t)
+typedef struct lglw_event_mouse_s {
+   int32_t  x;
+   int32_t  y;
+   uint32_t button_state;
+   uint32_t changed_button_state;
+   uint32_t num_merged;  // number of merged motion events (see lglw_mouse_motion_coalesce_set()). 0 for button events.
+} lglw_event_mouse_t;
+
+// Relative mouse motion event (see lglw_mouse_relative_fxn_t)
+typedef struct lglw_event_mouse_relative_s {
+   float    dx;
+   float    dy;
+   uint32_t button_state;
+} lglw_event_mouse_relative_t;
+
+// Focus event (see lglw_focus_fxn_t)
+typedef struct lglw_event_focus_s {
+   uint32_t focus_state;
+   uint32_t changed_focus_state;
+} lglw_event_focus_t;
+
+// Keyboard event (see lglw_keyboard_fxn_t)
+typedef struct lglw_event_keyboard_s {
+   uint32_t    vkey;
+   uint32_t    kmod;
+   lglw_bool_t b_pressed;
+   uint32_t    repeat_count;  // 0=initial key press, >0: auto-repeat (see lglw_keyboard_get_repeat_count())
+} lglw_event_keyboard_t;
+
+// Queued event (see lglw_events_poll())
+typedef struct lglw_event_s {
+   uint32_t type;         // see LGLW_EVENT_xxx
+   uint32_t server_time;  // X server timestamp (milliseconds, wraps around). 0 if not available.
+   uint64_t recv_ns;      // receive timestamp (nanoseconds, CLOCK_MONOTONIC)
+   union {
+      lglw_event_mouse_t          mouse;
+      lglw_event_focus_t          focus;
+      lglw_event_keyboard_t       keyboard;
+      lglw_event_mouse_relative_t mouse_relative;
+   } u;
+} lglw_event_t;
+
 // Initialize LGLW instance
 //  (note) (w; h) determine the hidden window size, which should match the size of the actual window that is created later on
 //  (note) when w or h is less than 16, a default width/height is used instead
 lglw_t lglw_init (int32_t _w, int32_t _h);
 
+// lglw_init_ex() flags
+#define LGLW_INIT_LAZY            (1u << 0)  // defer display connection, GL context and hidden window creation until first window_open() / glcontext_push()
+#define LGLW_INIT_SHARED_DISPLAY  (1u << 1)  // share one X connection with all other instances that use this flag (see lglw_events_shared())
+
+// Initialize LGLW instance (see lglw_init())
+//  (note) the GLX visual, colormap and atoms are looked up once per process and display.
+//          the first instance uses the cache connection. without LGLW_INIT_SHARED_DISPLAY, each further instance
+//          still needs its own X connection (the connection of an instance that has exited is reused, otherwise
+//          XOpenDisplay() is called). the cache is freed when the last instance exits.
+//  (note) Linux only
+lglw_t lglw_init_ex (int32_t _w, int32_t _h, uint32_t _flags);
+
 // Shutdown LGLW instance
 void lglw_exit (lglw_t _lglw);
 
+// Enable / disable the process-wide GL share group (default: disabled)
+//  When enabled, the GL contexts of all LGLW instances created afterwards share objects (textures, buffers, shaders, ..)
+//  with a hidden root context. The root context is created on demand and destroyed when the last instance context goes away.
+//  (note) there is one root context per X display. the member contexts are created on the same (process-wide) connection
+//          as the root context, since GL objects cannot reliably be shared across connections (e.g. Mesa DRI3)
+//  (note) only affects contexts that are created after the call (i.e. call this before lglw_init())
+//  (note) Linux only
+void lglw_glcontext_share_group_set (lglw_bool_t _bEnable);
+
+// Check if the instance context is part of the process-wide share group
+//  (note) Linux only
+lglw_bool_t lglw_glcontext_share_group_get (lglw_t _lglw);
+
 // Set LGLW instance userdata
 void lglw_userdata_set (lglw_t _lglw, void *_userData);
 
@@ -206,6 +339,8 @@ void lglw_redraw (lglw_t _lglw);
 void lglw_redraw_callback_set (lglw_t _lglw, lglw_redraw_fxn_t _cbk);
 
 // Save previous GL context and bind LGLW context
+//  (note) previous contexts are kept on a per-thread stack. push/pop calls must be balanced.
+//  (note) the context is not rebound when it is already current
 void lglw_glcontext_push (lglw_t _lglw);
 
 // Rebind LGLW context
@@ -213,11 +348,73 @@ void lglw_glcontext_push (lglw_t _lglw);
 void lglw_glcontext_rebind (lglw_t _lglw);
 
 // Unbind LGLW context and restore previous GL context
+//  (note) does nothing when the matching push() did not change the current context
 void lglw_glcontext_pop (lglw_t _lglw);
 
+// Query number of glXMakeCurrent() calls issued by push / pop, and number of push / pop calls that skipped the rebind
+//  (note) both pointers may be NULL
+//  (note) Linux only
+void lglw_glcontext_stats_get (lglw_t _lglw, uint32_t *_retNumBinds, uint32_t *_retNumBindsSkipped);
+
+// Create worker GL context that shares objects (textures, buffers, ..) with the instance context
+//  Used for uploading resources on a background thread while the UI thread keeps rendering.
+//  Return: worker handle or NULL
+//  (note) the worker must be destroyed before lglw_exit() is called
+//  (note) the worker context is created on the X connection of the instance context (objects cannot reliably be shared across connections)
+//  (note) Linux only
+lglw_glworker_t lglw_glcontext_worker_create (lglw_t _lglw);
+
+// Destroy worker GL context
+//  (note) Linux only
+void lglw_glcontext_worker_destroy (lglw_glworker_t _worker);
+
+// Bind worker GL context to the calling thread
+//  Return: 1=ok, 0=error
+//  (note) a worker context must only be bound to one thread at a time
+//  (note) Linux only
+lglw_bool_t lglw_glcontext_worker_bind (lglw_glworker_t _worker);
+
+// Unbind worker GL context from the calling thread
+//  (note) Linux only
+void lglw_glcontext_worker_unbind (lglw_glworker_t _worker);
+
+// Insert fence into the command stream of the current GL context (and flush)
+//  Typically called by the worker thread after it has issued its uploads, then handed over to the render thread.
+//  Return: fence handle or NULL (GL_ARB_sync not available)
+//  (note) Linux only
+lglw_glfence_t lglw_glfence_insert (void);
+
+// Wait (CPU) until the fence is signaled, or the timeout has elapsed
+//  Return: 1=signaled, 0=timeout / error
+//  (note) timeout 0 just polls the fence state
+//  (note) Linux only
+lglw_bool_t lglw_glfence_wait (lglw_glfence_t _fence, uint64_t _timeoutNS);
+
+// Make the current GL context wait (GPU) for the fence before it executes subsequent commands
+//  (note) does not block the calling thread
+//  (note) Linux only
+void lglw_glfence_wait_gpu (lglw_glfence_t _fence);
+
+// Delete fence
+//  (note) Linux only
+void lglw_glfence_delete (lglw_glfence_t _fence);
+
 // Swap front- and backbuffers
 void lglw_swap_buffers (lglw_t _lglw);
 
+// Install frame callback (NULL=remove). Called once per display refresh, right after the vertical blank.
+//  Uses GLX_OML_sync_control when available. Otherwise falls back to the RandR (>= 1.3) refresh rate of the monitor
+//  that shows the window, or 60Hz.
+//   (note) frame ticks are processed by lglw_events() / lglw_events_wait() (see lglw_timer_add())
+//   (note) the callback is only called while the window is open (it is suspended by lglw_window_close())
+//   (note) Linux only
+void lglw_frame_callback_set (lglw_t _lglw, lglw_frame_fxn_t _cbk);
+
+// Get display refresh period (nanoseconds)
+//   (note) only accurate while a frame callback is installed and the window is open
+//   (note) Linux only
+uint64_t lglw_frame_period_get (lglw_t _lglw);
+
 // Set swap interval (0=vsync off, 1=vsync on)
 void lglw_swap_interval_set (lglw_t _lglw, int32_t _ival);
 
@@ -227,6 +424,14 @@ int32_t lglw_swap_interval_get (lglw_t _lglw);
 // Install mouse callback
 void lglw_mouse_callback_set (lglw_t _lglw, lglw_mouse_fxn_t _cbk);
 
+// Install relative mouse motion callback (see LGLW_MOUSE_GRAB_RELATIVE)
+//  (note) uses XInput >= 2.1 raw motion events (unaccelerated, sub-pixel deltas). when the server does not support them, when the pointer is
+//          driven by an absolute device (tablet, touchscreen, virtual machine pointer), or when built with -DLGLW_USE_XINPUT2=0,
+//          falls back to core motion events. the pointer is then warped back to the window center when it gets close to the window edge.
+//  (note) the pointer is confined via XFixes pointer barriers (no active grab). falls back to a confined pointer grab when XFixes < 5.
+//  (note) Linux only
+void lglw_mouse_relative_callback_set (lglw_t _lglw, lglw_mouse_relative_fxn_t _cbk);
+
 // Install focus callback
 void lglw_focus_callback_set (lglw_t _lglw, lglw_focus_fxn_t _cbk);
 
@@ -239,6 +444,18 @@ uint32_t lglw_keyboard_get_modifiers (lglw_t _lglw);
 // Clear current key modifier state (workaround for stuck-modifier-after-dialog issue)
 void lglw_keyboard_clear_modifiers (lglw_t _lglw);
 
+// Enable / disable delivery of auto-repeated key presses (default=enabled)
+//  (note) held keys never send synthetic key releases. when disabled, there is one callback per real transition.
+//  (note) repeats are delivered as additional key presses. hosts can filter them via lglw_keyboard_get_repeat_count()
+//          (or lglw_event_keyboard_t.repeat_count)
+//  (note) Linux only
+void lglw_keyboard_repeat_set (lglw_t _lglw, lglw_bool_t _bEnable);
+
+// Get auto-repeat count of the key event that is currently being processed (0=initial press / release)
+//  (note) can be called from within the keyboard callback
+//  (note) Linux only
+uint32_t lglw_keyboard_get_repeat_count (lglw_t _lglw);
+
 // Get current mouse button state
 uint32_t lglw_mouse_get_buttons (lglw_t _lglw);
 
@@ -255,6 +472,38 @@ void lglw_mouse_warp (lglw_t _lglw, int32_t _x, int32_t _y);
 // Show / hide mouse pointer
 void lglw_mouse_cursor_show (lglw_t _lglw, lglw_bool_t _bShow);
 
+// Get standard mouse cursor (see LGLW_CURSOR_xxx)
+//  (note) created once per display and shared by all instances. must not be destroyed.
+//  (note) Linux only
+lglw_cursor_t lglw_cursor_standard_get (lglw_t _lglw, uint32_t _shape);
+
+// Create custom mouse cursor from 32bit ARGB pixels (premultiplied alpha, row-major)
+//  Return: cursor handle, or NULL if not supported (X server without RENDER extension)
+//  (note) Linux only
+lglw_cursor_t lglw_cursor_create_argb (lglw_t _lglw, uint32_t _w, uint32_t _h, int32_t _hotX, int32_t _hotY, const uint32_t *_argb);
+
+// Destroy custom mouse cursor (see lglw_cursor_create_argb())
+//  (note) Linux only
+void lglw_cursor_destroy (lglw_t _lglw, lglw_cursor_t _cursor);
+
+// Set mouse cursor of the window (NULL=parent's cursor)
+//  (note) does not send any requests when the cursor has not changed
+//  (note) a hidden pointer (see lglw_mouse_cursor_show()) stays hidden until it is shown again
+//  (note) Linux only
+void lglw_cursor_set (lglw_t _lglw, lglw_cursor_t _cursor);
+
+// Enable / disable merging of queued mouse motion events into a single mouse callback (default: disabled)
+//  (note) merging stops at the first non-motion event, i.e. button transitions are still delivered in order
+//  (note) in LGLW_MOUSE_GRAB_WARP mode, the callback position includes the summed delta of all merged events
+//  (note) Linux only
+void lglw_mouse_motion_coalesce_set (lglw_t _lglw, lglw_bool_t _bEnable);
+
+// Query motion info (only valid during a mouse motion callback)
+//   Return: number of motion events that were merged into the current callback (0 when not a motion callback)
+//   (note) retDX / retDY receive the summed position delta (may be NULL)
+//   (note) Linux only
+uint32_t lglw_mouse_motion_info_get (lglw_t _lglw, int32_t *_retDX, int32_t *_retDY);
+
 // Start periodic timer
 //  (note) requires an output window (see lglw_window_open())
 void lglw_timer_start (lglw_t _lglw, uint32_t _millisec);
@@ -265,12 +514,47 @@ void lglw_timer_stop (lglw_t _lglw);
 // Set periodic timer callback
 void lglw_timer_callback_set (lglw_t _lglw, lglw_timer_fxn_t _cbk);
 
+// Add periodic timer. Callbacks are scheduled at absolute deadlines (start + n*interval), i.e. they don't drift.
+//  The first callback is due after one interval.
+//   Return: timer id (0=error, e.g. too many timers)
+//   (note) timers are processed by lglw_events() / lglw_events_wait(). see lglw_event_fd_get()
+//   (note) it is safe to add / remove timers from within a timer callback
+//   (note) Linux only
+uint32_t lglw_timer_add (lglw_t _lglw, uint64_t _intervalNS, lglw_timer_ex_fxn_t _cbk, void *_userData);
+
+// Remove timer that was previously added via lglw_timer_add()
+//   (note) Linux only
+void lglw_timer_remove (lglw_t _lglw, uint32_t _timerId);
+
 // Get milliseconds since init
+//  (note) wraps around after ~49.7 days
 uint32_t lglw_time_get_millisec (lglw_t _lglw);
 
+// Get monotonic time in nanoseconds (CLOCK_MONOTONIC, not affected by system clock changes)
+//  (note) same time base as lglw_event_t::recv_ns and lglw_event_time_get()
+//  (note) Linux only
+uint64_t lglw_time_get_ns (lglw_t _lglw);
+
 // Set file drag'n'drop callback
+//  (note) Linux: XDND target (file:// URIs in text/uri-list). path names are only valid during the callback.
 void lglw_dropfiles_callback_set (lglw_t _lglw, lglw_dropfiles_fxn_t _cbk);
 
+// Start dragging data out of the window (e.g. from within a mouse button press / motion callback)
+//  The pointer is grabbed until the button is released. The drop target then requests one of the given types.
+//  (note) mimeTypes is a NULL terminated list of type names (e.g. "text/uri-list", "audio/wav"). max. 16 entries.
+//  (note) the provider is only called for the type that the target actually requests
+//  Return: 1=ok, 0=error (no window / pointer grab failed)
+//  (note) Linux only (XDND)
+lglw_bool_t lglw_drag_begin (lglw_t _lglw, const char **_mimeTypes, lglw_drag_provider_fxn_t _cbk);
+
+// Cancel current drag operation (if any)
+//  (note) Linux only
+void lglw_drag_cancel (lglw_t _lglw);
+
+// Query whether a drag operation (see lglw_drag_begin()) is in progress
+//  (note) Linux only
+lglw_bool_t lglw_drag_is_active (lglw_t _lglw);
+
 // Enable / disable Windows 8+ touch API
 void lglw_touchinput_set (lglw_t _lglw, lglw_bool_t _bEnable);
 
@@ -282,16 +566,85 @@ void lglw_touchkeyboard_show (lglw_t _lglw, lglw_bool_t _bEnable);
 
 // Set clipboard string
 //  (note) numChars==0: copy until (including) ASCIIz
+//  (note) replaces the current clipboard provider (see lglw_clipboard_provider_set())
 void lglw_clipboard_text_set (lglw_t _lglw, const uint32_t _numChars, const char *_text);
 
 // Get clipboard string
+//  (note) Linux: blocks until the clipboard owner has replied (returns an empty string when it does not respond within 2 seconds,
+//          or stops sending for 5 seconds during a large transfer). see lglw_clipboard_request_async().
 void lglw_clipboard_text_get (lglw_t _lglw, uint32_t _maxChars, uint32_t *_retNumChars, char *_retText);
 
+// Take clipboard ownership and provide the content on demand
+//  The provider is only called when another client pastes, so copying something that is never pasted costs nothing.
+//  (note) mimeTypes is a NULL terminated list of type names (e.g. "UTF8_STRING", "image/png", "application/x-mypreset"). max. 16 entries.
+//  (note) cbk=NULL gives up clipboard ownership
+//  (note) large content is transferred in chunks (INCR)
+//  Return: 1=ok, 0=error (no window)
+//  (note) Linux only
+lglw_bool_t lglw_clipboard_provider_set (lglw_t _lglw, const char **_mimeTypes, lglw_clipboard_provider_fxn_t _cbk);
+
+// Request clipboard content without blocking
+//  The callback is invoked from lglw_events() when the data has arrived, or the request failed / timed out / was cancelled
+//  (note) mimeType NULL = "UTF8_STRING" (text)
+//  (note) timeoutNS 0 = default timeout (2 seconds)
+//  (note) only one request can be pending. a new request cancels the previous one.
+//  (note) large transfers are delivered in chunks (see LGLW_CLIPBOARD_PARTIAL)
+//  Return: 1=request sent, 0=error (no window)
+//  (note) Linux only
+lglw_bool_t lglw_clipboard_request_async (lglw_t _lglw, const char *_mimeType, lglw_clipboard_fxn_t _cbk, uint64_t _timeoutNS);
+
+// Cancel pending clipboard request (callback is invoked with status LGLW_CLIPBOARD_CANCELLED)
+//  (note) Linux only
+void lglw_clipboard_request_cancel (lglw_t _lglw);
+
 // Process all available events and return (i.e.: don't loop, don't block)
 //  (note) events are usually delivered to the window's event callback (WndProc on Windows)
 //  (note) do we really need this on Linux ?
 void lglw_events (lglw_t _lglw);
 
+// Process all available events and due timers of all instances that were created with LGLW_INIT_SHARED_DISPLAY
+//  (note) lglw_events() on any of these instances also routes the events of the shared connection to their owners
+//  (note) must be called from the UI thread (the one that opens / closes windows and calls lglw_exit())
+//  (note) Linux only
+void lglw_events_shared (void);
+
+// Timeout value for lglw_events_wait() that waits until an event arrives or a timer is due
+#define LGLW_EVENTS_WAIT_INFINITE  (0xFFFFffffFFFFffffull)
+
+// Sleep until events arrive, a timer is due, or the timeout (nanoseconds) has elapsed.
+//  Then process all available events (see lglw_events())
+//   Return: LGLW_TRUE when woken up by new events, LGLW_FALSE on timeout
+//   (note) Linux only
+lglw_bool_t lglw_events_wait (lglw_t _lglw, uint64_t _timeoutNS);
+
+// Get file descriptor that becomes readable when lglw_events() has work to do
+//  (X input, periodic timer, redraw requests). For use with external select() / poll() / epoll loops.
+//   Return: fd or -1
+//   (note) the fd is owned by LGLW and must not be read from or closed by the caller
+//   (note) Linux only
+int lglw_event_fd_get (lglw_t _lglw);
+
+// Enable / disable event queue (default: disabled)
+//  When enabled, mouse, focus and keyboard input is stored in a per-instance ring buffer
+//  instead of being delivered to the respective callbacks. Use lglw_events_poll() to fetch the events.
+//  (note) enabling / disabling the queue discards all queued events
+//  (note) queued keyboard events are never forwarded to the parent window
+//  (note) Linux only
+void lglw_events_queue_enable (lglw_t _lglw, lglw_bool_t _bEnable);
+
+// Fetch up to 'maxEvents' queued events (oldest first)
+//   Return: number of events written to 'retEvents'
+//   (note) call after lglw_events() / lglw_events_wait()
+//   (note) Linux only
+uint32_t lglw_events_poll (lglw_t _lglw, lglw_event_t *_retEvents, uint32_t _maxEvents);
+
+// Get timestamps of the event that is currently being processed (call from within an event callback)
+//  'retServerTime' receives the X server timestamp (milliseconds, wraps around. 0 if not available)
+//  'retRecvNS' receives the time (nanoseconds, CLOCK_MONOTONIC) when the event was taken from the X queue
+//   (note) both pointers may be NULL
+//   (note) Linux only
+void lglw_event_time_get (lglw_t _lglw, uint32_t *_retServerTime, uint64_t *_retRecvNS);
+
 #include "cplusplus_end.h"
 
 #endif // __LGLW_H__
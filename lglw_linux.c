@@ -25,31 +25,56 @@
  * ----
  * ---- created: 04Aug2018
  * ---- changed: 05Aug2018, 06Aug2018, 07Aug2018, 08Aug2018, 09Aug2018, 18Aug2018, 10Oct2018
- * ----          16Oct2018, 19May2019
+ * ----          16Oct2018, 19May2019, 16Oct2026
  * ----
  * ----
  */
 
 // #define USE_XEVENTPROC defined
 
+#define _GNU_SOURCE  // ppoll()
+
 #include "lglw.h"
 
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdarg.h>
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 
 #include <X11/Xlib.h>
 #include <X11/Xutil.h>
 #include <X11/Xos.h>
 #include <X11/Xatom.h>
+#include <X11/XKBlib.h>
+#include <X11/cursorfont.h>
 
 #include <GL/gl.h>
 #include <GL/glx.h>
 
+#include <X11/extensions/Xrender.h>  // (note) link with -lXrender (ARGB cursors)
+#include <X11/extensions/Xrandr.h>   // (note) link with -lXrandr (refresh rate, see loc_randr_refresh_period_ns())
+#include <X11/extensions/Xfixes.h>   // (note) link with -lXfixes (pointer barriers)
+
+// XInput 2 raw motion events (LGLW_MOUSE_GRAB_RELATIVE)
+//  (note) build with -DLGLW_USE_XINPUT2=0 when libXi is not available (core motion fallback only)
+#ifndef LGLW_USE_XINPUT2
+#define LGLW_USE_XINPUT2  1
+#endif // LGLW_USE_XINPUT2
+
+#if LGLW_USE_XINPUT2
+#include <X11/extensions/XInput2.h>  // (note) link with -lXi
+#endif // LGLW_USE_XINPUT2
+
 #ifdef ARCH_X64
 #include <sys/mman.h>
-#include <unistd.h>
 #endif // ARCH_X64
 
 
@@ -90,15 +115,144 @@
 #define LGLW_MOUSE_TOUCH_RMB_STATE_RMB   (3u)
 #define LGLW_MOUSE_TOUCH_RMB_MOVE_THRESHOLD  (7u)
 
+#define LGLW_EVENT_QUEUE_SIZE  (256u)  // must be a power of two
+
+#define LGLW_MAX_TIMERS  (32u)
+
+#define LGLW_GLCONTEXT_STACK_SIZE  (16u)  // max. lglw_glcontext_push() nesting depth (per thread)
+
+#define LGLW_DISPLAY_CACHE_MAX_ATTRIBS  (32u)  // max. number of glXChooseVisual() attribs (incl. None)
+#define LGLW_DISPLAY_CACHE_MAX_IDLE     (4u)   // max. number of parked private connections per display (see loc_display_cache_connection_get())
+
+#define LGLW_WINDOW_MAP_SIZE       (1024u)  // must be a power of two
+#define LGLW_WINDOW_MAP_TOMBSTONE  ((Window)~0ul)
+
+#define LGLW_XI2_MAX_DEVICES  (128u)  // max. number of XInput 2 source devices whose valuator mode is cached (see loc_xi2_source_is_absolute())
+
+#define LGLW_MAX_SHARED_DISPLAYS  (8u)  // max. number of connections that are dispatched per lglw_events_shared() call
+
+#define LGLW_CLIPBOARD_DEFAULT_TIMEOUT_NS  (2000000000ull)  // 2 seconds
+#define LGLW_CLIPBOARD_INCR_TIMEOUT_NS     (5000000000ull)  // max. time between two INCR chunks (send)
+#define LGLW_CLIPBOARD_INCR_MAX_CHUNK_SIZE (256u * 1024u)   // also limited by the server's max. request size
+#define LGLW_CLIPBOARD_MAX_SEND_TRANSFERS  (4u)             // max. number of concurrent outgoing INCR transfers
+#define LGLW_CLIPBOARD_MAX_MIME_TYPES      (16u)            // see lglw_clipboard_provider_set()
+
+#define LGLW_XDND_VERSION               (5u)
+#define LGLW_XDND_FINISHED_TIMEOUT_NS   (5000000000ull)  // max. time between XdndDrop and XdndFinished (see lglw_drag_begin())
+
+// Atom table indices (see loc_atom_names[])
+#define LGLW_ATOM_CLIPBOARD         (0u)
+#define LGLW_ATOM_UTF8_STRING       (1u)
+#define LGLW_ATOM_CLIPBOARD_RESULT  (2u)
+#define LGLW_ATOM_LGLW              (3u)
+#define LGLW_ATOM_XEVENTPROC        (4u)
+#define LGLW_ATOM_INCR              (5u)
+#define LGLW_ATOM_TARGETS           (6u)
+#define LGLW_ATOM_XDND_AWARE        (7u)
+#define LGLW_ATOM_XDND_ENTER        (8u)
+#define LGLW_ATOM_XDND_POSITION     (9u)
+#define LGLW_ATOM_XDND_STATUS       (10u)
+#define LGLW_ATOM_XDND_LEAVE        (11u)
+#define LGLW_ATOM_XDND_DROP         (12u)
+#define LGLW_ATOM_XDND_FINISHED     (13u)
+#define LGLW_ATOM_XDND_SELECTION    (14u)
+#define LGLW_ATOM_XDND_TYPE_LIST    (15u)
+#define LGLW_ATOM_XDND_ACTION_COPY  (16u)
+#define LGLW_ATOM_TEXT_URI_LIST     (17u)
+#define LGLW_ATOM_XDND_RESULT       (18u)
+#define LGLW_NUM_ATOMS              (19u)
+
+#define LGLW_KEYSYM_TABLE_BASE  (0xFE00u)  // see loc_keysym_table[]
+#define LGLW_KEYSYM_TABLE_SIZE  (0x200u)   // ISO (0xFE00..0xFEFF) and function key (0xFF00..0xFFFF) keysym pages
+#define LGLW_KEYSYM_IDX(a)      ((a) - LGLW_KEYSYM_TABLE_BASE)
+
+#define LGLW_KEYSYM_UCS_NUM_PAGES  (14u)    // legacy keysym pages 0x01xx (Latin-2) .. 0x0Exx (Korean), see loc_keysym_ucs_table[]
+#define LGLW_KEYSYM_UCS_PAGE_BASE  (0xA0u)  // first keysym (low byte) of each page
+
+#define LGLW_FRAME_DEFAULT_PERIOD_NS  (16666667u)  // 60Hz, used when the refresh rate cannot be determined
+#define LGLW_FRAME_RESYNC_INTERVAL    (120u)       // re-read vblank timestamp every n frames (GLX_OML_sync_control)
+
 #define sABS(x) (((x)>0)?(x):-(x))
 
 
 // ---------------------------------------------------------------------------- structs and typedefs
+typedef struct lglw_timer_entry_s {
+   uint64_t            deadline_ns;  // absolute (CLOCK_MONOTONIC)
+   uint64_t            interval_ns;
+   uint32_t            id;
+   lglw_timer_ex_fxn_t cbk;
+   void               *user_data;
+} lglw_timer_entry_t;
+
+typedef struct lglw_glcontext_stack_entry_s {
+   Display     *xdsp;     // previously current display (or NULL)
+   GLXDrawable  drw;      // previously current drawable
+   GLXContext   ctx;      // previously current context
+   lglw_bool_t  b_bound;  // LGLW_TRUE if push() called glXMakeCurrent() (pop() must restore)
+} lglw_glcontext_stack_entry_t;
+
+// Process-wide display / visual / colormap cache entry (see loc_display_cache_ref())
+typedef struct lglw_display_cache_s {
+   struct lglw_display_cache_s *next;
+   char        *name;                                    // resolved display name (XDisplayName())
+   int          attrib[LGLW_DISPLAY_CACHE_MAX_ATTRIBS];  // glXChooseVisual() attribs (None terminated)
+   uint32_t     ref_count;
+   Display     *xdsp;      // cache connection (owns cmap and cursors). lent to the first private instance (see loc_display_cache_connection_get())
+   lglw_bool_t  b_xdsp_lent;   // LGLW_TRUE while xdsp is used as a private instance connection
+   Display     *shared_xdsp;   // LGLW_INIT_SHARED_DISPLAY instance connection (xdsp, or a separate connection when xdsp is lent). NULL=not used, yet.
+   uint32_t     num_idle;
+   Display     *idle_xdsp[LGLW_DISPLAY_CACHE_MAX_IDLE];  // private connections of exited instances (reused by new instances)
+   int          screen;
+   VisualID     visualid;
+   Colormap     cmap;
+   Atom         atoms[LGLW_NUM_ATOMS];  // see LGLW_ATOM_xxx
+   Cursor       cursors[LGLW_NUM_CURSORS];  // see lglw_cursor_standard_get(). created on demand.
+   GLXContext   share_ctx;        // share group root context (created on xdsp, never made current). see loc_share_group_ref()
+   uint32_t     share_ref_count;  // number of instance contexts that share objects with share_ctx
+} lglw_display_cache_t;
+
+// Keysym translation table entry (see loc_keysym_table[])
+typedef struct lglw_keysym_entry_s {
+   uint32_t vkey;  // LGLW_VKEY_xxx or character code. 0=unmapped.
+   uint32_t kmod;  // LGLW_KMOD_xxx (modifier keys)
+} lglw_keysym_entry_t;
+
+// Selection content provider (CLIPBOARD and XdndSelection)
+typedef struct lglw_selection_provider_s {
+   lglw_clipboard_provider_fxn_t cbk;  // non-NULL while we own the selection
+   uint32_t num_types;
+   char    *mime_types[LGLW_CLIPBOARD_MAX_MIME_TYPES];
+   Atom     atoms[LGLW_CLIPBOARD_MAX_MIME_TYPES];
+   Time     owner_time;  // see SelectionClear
+} lglw_selection_provider_t;
+
+// Outgoing INCR clipboard transfer (see loc_clipboard_send_begin())
+typedef struct lglw_clipboard_send_s {
+   Window       requestor;   // 0=unused
+   Atom         selection;   // see loc_clipboard_send_abort()
+   Atom         property;
+   Atom         type;
+   const char  *data;
+   uint32_t     num_bytes;
+   uint32_t     offset;      // number of bytes sent so far
+   lglw_bool_t  b_select;    // LGLW_TRUE if PropertyChangeMask was selected on the (foreign) requestor window
+   uint32_t     timer_id;
+} lglw_clipboard_send_t;
+
 typedef struct lglw_int_s {
    void        *user_data;    // arbitrary user data
    Display     *xdsp;
    XVisualInfo *vi;
-   Colormap     cmap;
+   Colormap     cmap;         // owned by dcache
+   lglw_display_cache_t *dcache;
+   const Atom  *atoms;        // dcache->atoms (see LGLW_ATOM_xxx)
+   uint32_t     init_flags;   // LGLW_INIT_xxx
+   lglw_bool_t  b_shared_xdsp;  // LGLW_TRUE if xdsp is the (shared) dcache->shared_xdsp connection
+   struct {
+      uint64_t           serial;  // registration order (see lglw_events_shared())
+      struct lglw_int_s *next;
+      struct lglw_int_s *prev;
+   } shared;
    Window       parent_xwnd;  // created by host
 
    struct {
@@ -115,15 +269,21 @@ typedef struct lglw_int_s {
    } win;
 
    GLXContext   ctx;
+   Display     *gl_xdsp;        // connection that ctx was created on (dcache->xdsp for share group members, xdsp otherwise)
+   lglw_bool_t  b_share_group;  // LGLW_TRUE if ctx holds a reference to the dcache share group root context
 
    struct {
-      GLXContext   ctx;
-      GLXDrawable  drw;
-   } prev;
+      uint32_t num_binds;          // number of glXMakeCurrent() calls issued by push / pop
+      uint32_t num_binds_skipped;  // number of push / pop calls that did not need to rebind
+   } glctx_stats;
 
    struct {
       uint32_t            kmod_state;  // See LGLW_KMOD_xxx
       lglw_keyboard_fxn_t cbk;
+      lglw_bool_t         b_detectable_repeat;  // LGLW_TRUE if server suppresses synthetic KeyRelease events (XkbSetDetectableAutoRepeat())
+      lglw_bool_t         b_repeat;             // see lglw_keyboard_repeat_set()
+      uint32_t            repeat_count;         // number of auto-repeats of the current key (0=initial press)
+      uint8_t             down[32];             // pressed keys (bit per keycode)
    } keyboard;
 
    struct {
@@ -136,6 +296,22 @@ typedef struct lglw_int_s {
          lglw_bool_t      b_queue_warp;
          lglw_vec2i_t     last_p;
       } grab;
+      struct {
+         lglw_mouse_relative_fxn_t cbk;
+         lglw_bool_t      b_raw;       // LGLW_TRUE while XI_RawMotion events are selected (XInput2)
+         int              xi_opcode;   // XInput extension major opcode. 0=not queried, -1=XInput 2 not available
+         lglw_bool_t      b_raw_absolute;  // LGLW_TRUE while the pointer is driven by an absolute device (raw motion is ignored, core motion fallback)
+         uint8_t          xi_source_modes[LGLW_XI2_MAX_DEVICES];  // 0=not queried, 1=relative, 2=absolute (per source device id)
+         int              xfixes_major;  // XFixes version. 0=not queried, -1=not available
+         lglw_bool_t      b_grabbed;   // LGLW_TRUE if the pointer is confined by an active grab (pointer barriers not available)
+         unsigned long    warp_serial;  // request serial of the last re-centering warp (core motion fallback)
+         PointerBarrier   barriers[4];  // left, right, top, bottom window edge (see loc_pointer_barriers_create())
+      } relative;  // see LGLW_MOUSE_GRAB_RELATIVE
+      struct {
+         lglw_bool_t      b_coalesce;  // see lglw_mouse_motion_coalesce_set()
+         uint32_t         num_merged;  // number of MotionNotify events merged into current callback
+         lglw_vec2i_t     delta;       // summed motion delta of current callback
+      } motion;
       struct {
          lglw_bool_t      b_enable;
          lglw_bool_t      b_update_queued;
@@ -146,40 +322,388 @@ typedef struct lglw_int_s {
       } touch;
    } mouse;
 
+   struct {
+      Cursor       current;   // see lglw_cursor_set(). None=parent's cursor.
+      Cursor       defined;   // cursor that was last assigned to win.xwnd
+      lglw_bool_t  b_hidden;  // see lglw_mouse_cursor_show()
+   } cursor;
+
    struct {
       uint32_t         state;
       lglw_focus_fxn_t cbk;
    } focus;
 
    struct {
-      lglw_bool_t      b_running;
-      lglw_timer_fxn_t cbk;
-      struct timeval   tv_start;
-      uint32_t         interval_ms;
-      uint32_t         last_ms;
+      lglw_bool_t        b_running;   // see lglw_timer_start()
+      lglw_timer_fxn_t   cbk;
+      uint32_t           legacy_id;   // heap timer that drives 'cbk'
+      uint64_t           start_ns;    // CLOCK_MONOTONIC time of lglw_init()
+      int                fd;          // timerfd (armed at earliest deadline, wakes up event fd)
+      uint32_t           next_id;
+      uint32_t           num_timers;
+      lglw_timer_entry_t heap[LGLW_MAX_TIMERS];  // min-heap ordered by deadline_ns
    } timer;
 
    struct {
       uint32_t numChars;
       char *data;
+
+      struct {
+         lglw_clipboard_fxn_t cbk;        // non-NULL while a request is pending
+         char                *mime_type;  // requested type (passed to cbk)
+         Atom                 target;
+         uint32_t             timer_id;   // timeout
+         lglw_bool_t          b_incr;     // LGLW_TRUE while receiving INCR chunks
+      } req;  // see lglw_clipboard_request_async()
+
+      uint32_t              incr_chunk_size;  // 0=not determined, yet
+      lglw_clipboard_send_t send[LGLW_CLIPBOARD_MAX_SEND_TRANSFERS];
+
+      lglw_selection_provider_t provider;  // see lglw_clipboard_provider_set()
    } clipboard;
 
+   struct {
+      lglw_selection_provider_t provider;  // XdndSelection content. cbk is non-NULL while dragging.
+      Window      target;              // XdndAware window under the pointer (0=none)
+      uint32_t    target_version;
+      Window      toplevel;            // child of the root window under the pointer (see loc_xdnd_find_target())
+      Window      toplevel_target;     // XdndAware window in 'toplevel' (0=none)
+      uint32_t    toplevel_version;
+      lglw_bool_t b_accepted;          // last XdndStatus
+      lglw_bool_t b_status_pending;    // XdndPosition sent, waiting for XdndStatus
+      lglw_bool_t b_position_pending;  // pointer moved while waiting for XdndStatus
+      lglw_bool_t b_drop_pending;      // button released while waiting for XdndStatus
+      lglw_bool_t b_dropped;           // XdndDrop sent, waiting for XdndFinished
+      int32_t     root_x;
+      int32_t     root_y;
+      Time        time;                // last pointer event
+      uint32_t    timer_id;            // XdndFinished timeout
+   } drag;  // see lglw_drag_begin()
+
    struct {
       lglw_dropfiles_fxn_t cbk;
+
+      struct {
+         Window      source;      // 0=no drag in progress
+         uint32_t    version;     // negotiated protocol version
+         lglw_bool_t b_accept;    // source offers text/uri-list
+         lglw_bool_t b_dropping;  // waiting for SelectionNotify
+         int32_t     root_x;      // last XdndPosition
+         int32_t     root_y;
+      } xdnd;
    } dropfiles;
 
    struct {
       lglw_redraw_fxn_t cbk;
    } redraw;
 
+   struct {
+      lglw_frame_fxn_t cbk;
+      uint32_t         timer_id;
+      uint64_t         period_ns;
+      uint64_t         phase_ns;      // CLOCK_MONOTONIC time of a past display refresh
+      lglw_bool_t      b_oml;         // GLX_OML_sync_control available
+      uint32_t         resync_count;  // frames until next loc_frame_sync()
+      int              randr_status;  // 0=not queried, 1=RandR >= 1.3 available, -1=not available
+   } frame;
+
+   struct {
+      int      fd;           // epoll fd (see lglw_event_fd_get()). watches X connection, timer and wakeup fds
+      int      wakeup_fd;    // eventfd. signalled by redraw requests and events that are already queued by Xlib
+      uint32_t server_time;  // X server timestamp (milliseconds) of the event that is currently being processed
+      uint64_t recv_ns;      // CLOCK_MONOTONIC timestamp (nanoseconds) taken when current event was dequeued
+   } event;
+
+   struct {
+      lglw_bool_t  b_enable;     // see lglw_events_queue_enable()
+      uint32_t     read_idx;
+      uint32_t     write_idx;
+      uint32_t     num_dropped;  // number of events lost due to queue overflow
+      lglw_event_t events[LGLW_EVENT_QUEUE_SIZE];
+   } queue;
+
 } lglw_int_t;
 
+typedef struct lglw_glworker_int_s {
+   lglw_int_t  *lglw;   // owning instance
+   Display     *xdsp;   // connection of the instance context (lglw->gl_xdsp)
+   Window       xwnd;   // tiny unmapped window (GLX needs a drawable to bind the context)
+   GLXContext   ctx;    // shares objects with lglw->ctx
+} lglw_glworker_int_t;
+
+
+// ---------------------------------------------------------------------------- module vars
+static __thread struct {
+   uint32_t                     depth;
+   lglw_glcontext_stack_entry_t entries[LGLW_GLCONTEXT_STACK_SIZE];
+} loc_glcontext_stack;  // see lglw_glcontext_push()
+
+static struct {
+   pthread_mutex_t mtx;       // also protects lglw_display_cache_t.share_ctx / share_ref_count
+   lglw_bool_t     b_enable;  // see lglw_glcontext_share_group_set()
+} loc_share_group = { PTHREAD_MUTEX_INITIALIZER, LGLW_FALSE };  // (note) the root contexts are per display (see loc_share_group_ref())
+
+static struct {
+   pthread_mutex_t       mtx;
+   lglw_display_cache_t *first;
+} loc_display_cache = { PTHREAD_MUTEX_INITIALIZER, NULL };
+
+static struct {
+   pthread_mutex_t mtx;
+   uint64_t        next_serial;
+   lglw_int_t     *first;  // ascending serial
+   lglw_int_t     *last;
+} loc_shared_instances = { PTHREAD_MUTEX_INITIALIZER, 1u, NULL, NULL };  // LGLW_INIT_SHARED_DISPLAY instances (see lglw_events_shared())
+
+static char *loc_atom_names[LGLW_NUM_ATOMS] = {
+   "CLIPBOARD",          // LGLW_ATOM_CLIPBOARD
+   "UTF8_STRING",        // LGLW_ATOM_UTF8_STRING
+   "_clipboard_result",  // LGLW_ATOM_CLIPBOARD_RESULT
+   "_lglw",              // LGLW_ATOM_LGLW
+   "_XEventProc",        // LGLW_ATOM_XEVENTPROC
+   "INCR",               // LGLW_ATOM_INCR
+   "TARGETS",            // LGLW_ATOM_TARGETS
+   "XdndAware",          // LGLW_ATOM_XDND_AWARE
+   "XdndEnter",          // LGLW_ATOM_XDND_ENTER
+   "XdndPosition",       // LGLW_ATOM_XDND_POSITION
+   "XdndStatus",         // LGLW_ATOM_XDND_STATUS
+   "XdndLeave",          // LGLW_ATOM_XDND_LEAVE
+   "XdndDrop",           // LGLW_ATOM_XDND_DROP
+   "XdndFinished",       // LGLW_ATOM_XDND_FINISHED
+   "XdndSelection",      // LGLW_ATOM_XDND_SELECTION
+   "XdndTypeList",       // LGLW_ATOM_XDND_TYPE_LIST
+   "XdndActionCopy",     // LGLW_ATOM_XDND_ACTION_COPY
+   "text/uri-list",      // LGLW_ATOM_TEXT_URI_LIST
+   "_lglw_dnd_result",   // LGLW_ATOM_XDND_RESULT
+};
+
+// Special key / modifier keysyms => vkey (see loc_handle_xkey())
+//  (note) Latin-1 and Unicode keysyms map directly to character codes and are not stored here
+static const lglw_keysym_entry_t loc_keysym_table[LGLW_KEYSYM_TABLE_SIZE] = {
+   [LGLW_KEYSYM_IDX(XK_ISO_Left_Tab)]     = { LGLW_VKEY_TAB,        0u                },  // shift-tab
+   [LGLW_KEYSYM_IDX(XK_ISO_Level3_Shift)] = { LGLW_VKEY_RALT,       LGLW_KMOD_RALT    },  // AltGr
+
+   [LGLW_KEYSYM_IDX(XK_BackSpace)]        = { LGLW_VKEY_BACKSPACE,  0u                },
+   [LGLW_KEYSYM_IDX(XK_Tab)]              = { LGLW_VKEY_TAB,        0u                },
+   [LGLW_KEYSYM_IDX(XK_Return)]           = { LGLW_VKEY_RETURN,     0u                },
+   [LGLW_KEYSYM_IDX(XK_Scroll_Lock)]      = { LGLW_VKEY_SCROLLLOCK, 0u                },
+   [LGLW_KEYSYM_IDX(XK_Escape)]           = { LGLW_VKEY_ESCAPE,     0u                },
+   [LGLW_KEYSYM_IDX(XK_Delete)]           = { LGLW_VKEY_DELETE,     0u                },
+
+   [LGLW_KEYSYM_IDX(XK_Home)]             = { LGLW_VKEY_HOME,       0u                },
+   [LGLW_KEYSYM_IDX(XK_Left)]             = { LGLW_VKEY_LEFT,       0u                },
+   [LGLW_KEYSYM_IDX(XK_Up)]               = { LGLW_VKEY_UP,         0u                },
+   [LGLW_KEYSYM_IDX(XK_Right)]            = { LGLW_VKEY_RIGHT,      0u                },
+   [LGLW_KEYSYM_IDX(XK_Down)]             = { LGLW_VKEY_DOWN,       0u                },
+   [LGLW_KEYSYM_IDX(XK_Prior)]            = { LGLW_VKEY_PAGEUP,     0u                },
+   [LGLW_KEYSYM_IDX(XK_Next)]             = { LGLW_VKEY_PAGEDOWN,   0u                },
+   [LGLW_KEYSYM_IDX(XK_End)]              = { LGLW_VKEY_END,        0u                },
+   [LGLW_KEYSYM_IDX(XK_Insert)]           = { LGLW_VKEY_INSERT,     0u                },
+   [LGLW_KEYSYM_IDX(XK_Menu)]             = { LGLW_VKEY_RSUPER,     0u                },  // context menu
+   [LGLW_KEYSYM_IDX(XK_Num_Lock)]         = { LGLW_VKEY_NUMLOCK,    0u                },
+
+   [LGLW_KEYSYM_IDX(XK_KP_Space)]         = { ' ',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Tab)]           = { LGLW_VKEY_TAB,        0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Enter)]         = { LGLW_VKEY_RETURN,     0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Home)]          = { LGLW_VKEY_HOME,       0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Left)]          = { LGLW_VKEY_LEFT,       0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Up)]            = { LGLW_VKEY_UP,         0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Right)]         = { LGLW_VKEY_RIGHT,      0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Down)]          = { LGLW_VKEY_DOWN,       0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Prior)]         = { LGLW_VKEY_PAGEUP,     0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Next)]          = { LGLW_VKEY_PAGEDOWN,   0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_End)]           = { LGLW_VKEY_END,        0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Insert)]        = { LGLW_VKEY_INSERT,     0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Delete)]        = { LGLW_VKEY_DELETE,     0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Equal)]         = { '=',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Multiply)]      = { '*',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Add)]           = { '+',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Separator)]     = { ',',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Subtract)]      = { '-',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Decimal)]       = { '.',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_Divide)]        = { '/',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_0)]             = { '0',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_1)]             = { '1',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_2)]             = { '2',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_3)]             = { '3',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_4)]             = { '4',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_5)]             = { '5',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_6)]             = { '6',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_7)]             = { '7',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_8)]             = { '8',                  0u                },
+   [LGLW_KEYSYM_IDX(XK_KP_9)]             = { '9',                  0u                },
+
+   [LGLW_KEYSYM_IDX(XK_F1)]               = { LGLW_VKEY_F1,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F2)]               = { LGLW_VKEY_F2,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F3)]               = { LGLW_VKEY_F3,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F4)]               = { LGLW_VKEY_F4,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F5)]               = { LGLW_VKEY_F5,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F6)]               = { LGLW_VKEY_F6,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F7)]               = { LGLW_VKEY_F7,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F8)]               = { LGLW_VKEY_F8,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F9)]               = { LGLW_VKEY_F9,         0u                },
+   [LGLW_KEYSYM_IDX(XK_F10)]              = { LGLW_VKEY_F10,        0u                },
+   [LGLW_KEYSYM_IDX(XK_F11)]              = { LGLW_VKEY_F11,        0u                },
+   [LGLW_KEYSYM_IDX(XK_F12)]              = { LGLW_VKEY_F12,        0u                },
+
+   [LGLW_KEYSYM_IDX(XK_Shift_L)]          = { LGLW_VKEY_LSHIFT,     LGLW_KMOD_LSHIFT  },
+   [LGLW_KEYSYM_IDX(XK_Shift_R)]          = { LGLW_VKEY_RSHIFT,     LGLW_KMOD_RSHIFT  },
+   [LGLW_KEYSYM_IDX(XK_Control_L)]        = { LGLW_VKEY_LCTRL,      LGLW_KMOD_LCTRL   },
+   [LGLW_KEYSYM_IDX(XK_Control_R)]        = { LGLW_VKEY_RCTRL,      LGLW_KMOD_RCTRL   },
+   [LGLW_KEYSYM_IDX(XK_Meta_L)]           = { LGLW_VKEY_LALT,       LGLW_KMOD_LALT    },  // (note) Alt+Shift on some layouts
+   [LGLW_KEYSYM_IDX(XK_Meta_R)]           = { LGLW_VKEY_RALT,       LGLW_KMOD_RALT    },
+   [LGLW_KEYSYM_IDX(XK_Alt_L)]            = { LGLW_VKEY_LALT,       LGLW_KMOD_LALT    },
+   [LGLW_KEYSYM_IDX(XK_Alt_R)]            = { LGLW_VKEY_RALT,       LGLW_KMOD_RALT    },
+   [LGLW_KEYSYM_IDX(XK_Super_L)]          = { LGLW_VKEY_LSUPER,     LGLW_KMOD_LSUPER  },
+   [LGLW_KEYSYM_IDX(XK_Super_R)]          = { LGLW_VKEY_RSUPER,     LGLW_KMOD_RSUPER  },
+};
+
+// Legacy keysym => Unicode (see loc_keysym_to_ucs())
+//  (note) generated from the U+ annotations in <X11/keysymdef.h>. 0=unmapped.
+static const uint16_t loc_keysym_ucs_table[LGLW_KEYSYM_UCS_NUM_PAGES][256u - LGLW_KEYSYM_UCS_PAGE_BASE] = {
+   {  // 0x01xx Latin-2
+      0x0000, 0x0104, 0x02D8, 0x0141, 0x0000, 0x013D, 0x015A, 0x0000, 0x0000, 0x0160, 0x015E, 0x0164, 0x0179, 0x0000, 0x017D, 0x017B,
+      0x0000, 0x0105, 0x02DB, 0x0142, 0x0000, 0x013E, 0x015B, 0x02C7, 0x0000, 0x0161, 0x015F, 0x0165, 0x017A, 0x02DD, 0x017E, 0x017C,
+      0x0154, 0x0000, 0x0000, 0x0102, 0x0000, 0x0139, 0x0106, 0x0000, 0x010C, 0x0000, 0x0118, 0x0000, 0x011A, 0x0000, 0x0000, 0x010E,
+      0x0110, 0x0143, 0x0147, 0x0000, 0x0000, 0x0150, 0x0000, 0x0000, 0x0158, 0x016E, 0x0000, 0x0170, 0x0000, 0x0000, 0x0162, 0x0000,
+      0x0155, 0x0000, 0x0000, 0x0103, 0x0000, 0x013A, 0x0107, 0x0000, 0x010D, 0x0000, 0x0119, 0x0000, 0x011B, 0x0000, 0x0000, 0x010F,
+      0x0111, 0x0144, 0x0148, 0x0000, 0x0000, 0x0151, 0x0000, 0x0000, 0x0159, 0x016F, 0x0000, 0x0171, 0x0000, 0x0000, 0x0163, 0x02D9
+   },
+   {  // 0x02xx Latin-3
+      0x0000, 0x0126, 0x0000, 0x0000, 0x0000, 0x0000, 0x0124, 0x0000, 0x0000, 0x0130, 0x0000, 0x011E, 0x0134, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0127, 0x0000, 0x0000, 0x0000, 0x0000, 0x0125, 0x0000, 0x0000, 0x0131, 0x0000, 0x011F, 0x0135, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x010A, 0x0108, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0120, 0x0000, 0x0000, 0x011C, 0x0000, 0x0000, 0x0000, 0x0000, 0x016C, 0x015C, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x010B, 0x0109, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0121, 0x0000, 0x0000, 0x011D, 0x0000, 0x0000, 0x0000, 0x0000, 0x016D, 0x015D, 0x0000
+   },
+   {  // 0x03xx Latin-4
+      0x0000, 0x0000, 0x0138, 0x0156, 0x0000, 0x0128, 0x013B, 0x0000, 0x0000, 0x0000, 0x0112, 0x0122, 0x0166, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0157, 0x0000, 0x0129, 0x013C, 0x0000, 0x0000, 0x0000, 0x0113, 0x0123, 0x0167, 0x014A, 0x0000, 0x014B,
+      0x0100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0116, 0x0000, 0x0000, 0x012A,
+      0x0000, 0x0145, 0x014C, 0x0136, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0172, 0x0000, 0x0000, 0x0000, 0x0168, 0x016A, 0x0000,
+      0x0101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x012F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0117, 0x0000, 0x0000, 0x012B,
+      0x0000, 0x0146, 0x014D, 0x0137, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0173, 0x0000, 0x0000, 0x0000, 0x0169, 0x016B, 0x0000
+   },
+   {  // 0x04xx Katakana
+      0x0000, 0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3, 0x30A5, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3,
+      0x30FC, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0x30B5, 0x30B7, 0x30B9, 0x30BB, 0x30BD,
+      0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D2, 0x30D5, 0x30D8, 0x30DB, 0x30DE,
+      0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x309B, 0x309C,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+   },
+   {  // 0x05xx Arabic
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x060C, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x061B, 0x0000, 0x0000, 0x0000, 0x061F,
+      0x0000, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627, 0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+      0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637, 0x0638, 0x0639, 0x063A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647, 0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F,
+      0x0650, 0x0651, 0x0652, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+   },
+   {  // 0x06xx Cyrillic
+      0x0000, 0x0452, 0x0453, 0x0451, 0x0454, 0x0455, 0x0456, 0x0457, 0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x0491, 0x045E, 0x045F,
+      0x2116, 0x0402, 0x0403, 0x0401, 0x0404, 0x0405, 0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x0490, 0x040E, 0x040F,
+      0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433, 0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+      0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432, 0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A,
+      0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413, 0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+      0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412, 0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A
+   },
+   {  // 0x07xx Greek
+      0x0000, 0x0386, 0x0388, 0x0389, 0x038A, 0x03AA, 0x0000, 0x038C, 0x038E, 0x03AB, 0x0000, 0x038F, 0x0000, 0x0000, 0x0385, 0x2015,
+      0x0000, 0x03AC, 0x03AD, 0x03AE, 0x03AF, 0x03CA, 0x0390, 0x03CC, 0x03CD, 0x03CB, 0x03B0, 0x03CE, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+      0x03A0, 0x03A1, 0x03A3, 0x0000, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+      0x03C0, 0x03C1, 0x03C3, 0x03C2, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+   },
+   {  // 0x08xx Technical
+      0x0000, 0x23B7, 0x250C, 0x2500, 0x2320, 0x2321, 0x2502, 0x23A1, 0x23A3, 0x23A4, 0x23A6, 0x239B, 0x239D, 0x239E, 0x23A0, 0x23A8,
+      0x23AC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2264, 0x2260, 0x2265, 0x222B,
+      0x2234, 0x221D, 0x221E, 0x0000, 0x0000, 0x2207, 0x0000, 0x0000, 0x223C, 0x2243, 0x0000, 0x0000, 0x0000, 0x21D4, 0x21D2, 0x2261,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x221A, 0x0000, 0x0000, 0x0000, 0x2282, 0x2283, 0x2229, 0x222A, 0x2227, 0x2228,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2202,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0192, 0x0000, 0x0000, 0x0000, 0x0000, 0x2190, 0x2191, 0x2192, 0x2193, 0x0000
+   },
+   {  // 0x09xx Special
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x25C6, 0x2592, 0x2409, 0x240C, 0x240D, 0x240A, 0x0000, 0x0000, 0x2424, 0x240B, 0x2518, 0x2510, 0x250C, 0x2514, 0x253C, 0x23BA,
+      0x23BB, 0x2500, 0x23BC, 0x23BD, 0x251C, 0x2524, 0x2534, 0x252C, 0x2502, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+   },
+   {  // 0x0Axx Publishing
+      0x0000, 0x2003, 0x2002, 0x2004, 0x2005, 0x2007, 0x2008, 0x2009, 0x200A, 0x2014, 0x2013, 0x0000, 0x2423, 0x0000, 0x2026, 0x2025,
+      0x2153, 0x2154, 0x2155, 0x2156, 0x2157, 0x2158, 0x2159, 0x215A, 0x2105, 0x0000, 0x0000, 0x2012, 0x2329, 0x002E, 0x232A, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x215B, 0x215C, 0x215D, 0x215E, 0x0000, 0x0000, 0x2122, 0x2613, 0x0000, 0x25C1, 0x25B7, 0x25CB, 0x25AF,
+      0x2018, 0x2019, 0x201C, 0x201D, 0x211E, 0x2030, 0x2032, 0x2033, 0x0000, 0x271D, 0x0000, 0x25AC, 0x25C0, 0x25B6, 0x25CF, 0x25AE,
+      0x25E6, 0x25AB, 0x25AD, 0x25B3, 0x25BD, 0x2606, 0x2022, 0x25AA, 0x25B2, 0x25BC, 0x261C, 0x261E, 0x2663, 0x2666, 0x2665, 0x0000,
+      0x2720, 0x2020, 0x2021, 0x2713, 0x2717, 0x266F, 0x266D, 0x2642, 0x2640, 0x260E, 0x2315, 0x2117, 0x2038, 0x201A, 0x201E, 0x0000
+   },
+   {  // 0x0Bxx APL
+      0x0000, 0x0000, 0x0000, 0x003C, 0x0000, 0x0000, 0x003E, 0x0000, 0x2228, 0x2227, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x00AF, 0x0000, 0x22A4, 0x2229, 0x230A, 0x0000, 0x005F, 0x0000, 0x0000, 0x0000, 0x2218, 0x0000, 0x2395, 0x0000, 0x22A5, 0x25CB,
+      0x0000, 0x0000, 0x0000, 0x2308, 0x0000, 0x0000, 0x222A, 0x0000, 0x2283, 0x0000, 0x2282, 0x0000, 0x22A3, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x22A2, 0x0000, 0x0000, 0x0000
+   },
+   {  // 0x0Cxx Hebrew
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2017,
+      0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+      0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+   },
+   {  // 0x0Dxx Thai
+      0x0000, 0x0E01, 0x0E02, 0x0E03, 0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+      0x0E10, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A, 0x0E1B, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F,
+      0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0E2C, 0x0E2D, 0x0E2E, 0x0E2F,
+      0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0E38, 0x0E39, 0x0E3A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E3F,
+      0x0E40, 0x0E41, 0x0E42, 0x0E43, 0x0E44, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0E4C, 0x0E4D, 0x0000, 0x0000,
+      0x0E50, 0x0E51, 0x0E52, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E59, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+   },
+   {  // 0x0Exx Korean
+      0x0000, 0x3131, 0x3132, 0x3133, 0x3134, 0x3135, 0x3136, 0x3137, 0x3138, 0x3139, 0x313A, 0x313B, 0x313C, 0x313D, 0x313E, 0x313F,
+      0x3140, 0x3141, 0x3142, 0x3143, 0x3144, 0x3145, 0x3146, 0x3147, 0x3148, 0x3149, 0x314A, 0x314B, 0x314C, 0x314D, 0x314E, 0x314F,
+      0x3150, 0x3151, 0x3152, 0x3153, 0x3154, 0x3155, 0x3156, 0x3157, 0x3158, 0x3159, 0x315A, 0x315B, 0x315C, 0x315D, 0x315E, 0x315F,
+      0x3160, 0x3161, 0x3162, 0x3163, 0x11A8, 0x11A9, 0x11AA, 0x11AB, 0x11AC, 0x11AD, 0x11AE, 0x11AF, 0x11B0, 0x11B1, 0x11B2, 0x11B3,
+      0x11B4, 0x11B5, 0x11B6, 0x11B7, 0x11B8, 0x11B9, 0x11BA, 0x11BB, 0x11BC, 0x11BD, 0x11BE, 0x11BF, 0x11C0, 0x11C1, 0x11C2, 0x316D,
+      0x3171, 0x3178, 0x317F, 0x3181, 0x3184, 0x3186, 0x318D, 0x318E, 0x11EB, 0x11F0, 0x11F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x20A9
+   }
+};
+
+static struct {
+   pthread_mutex_t mtx;  // serializes writers. lookups are lock-free.
+   struct {
+      Window      xwnd;  // 0=free, LGLW_WINDOW_MAP_TOMBSTONE=deleted
+      lglw_int_t *lglw;
+   } entries[LGLW_WINDOW_MAP_SIZE];
+   lglw_bool_t b_overflow;  // LGLW_TRUE after the map ran full once (lookups then fall back to the _lglw window property, see loc_events_dispatch())
+} loc_window_map = { PTHREAD_MUTEX_INITIALIZER, { { 0, NULL } }, LGLW_FALSE };  // Window => instance (see loc_window_map_find())
+
+static lglw_int_t *loc_mouse_relative_owner = NULL;  // instance in LGLW_MOUSE_GRAB_RELATIVE mode (raw XInput2 events are not window-specific)
+
+static struct {
+   pthread_once_t          once;
+   PFNGLFENCESYNCPROC      FenceSync;
+   PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+   PFNGLWAITSYNCPROC       WaitSync;
+   PFNGLDELETESYNCPROC     DeleteSync;
+} loc_glsync = { PTHREAD_ONCE_INIT, NULL, NULL, NULL, NULL };  // GL_ARB_sync entry points (see lglw_glfence_insert())
+
 
 // ---------------------------------------------------------------------------- module fxn fwd decls
 static lglw_bool_t loc_create_hidden_window (lglw_int_t *lglw, int32_t _w, int32_t _h);
 static void loc_destroy_hidden_window(lglw_int_t *lglw);
 
 static lglw_bool_t loc_handle_key (lglw_int_t *lglw, lglw_bool_t _bPressed, uint32_t _vkey);
+static lglw_bool_t loc_handle_xkey (lglw_int_t *lglw, XKeyEvent *_ev);
+static void loc_kmod_sync (lglw_int_t *lglw, unsigned int _state);
+static lglw_bool_t loc_key_is_autorepeat_release (lglw_int_t *lglw, XKeyEvent *_ev);
+static uint32_t loc_keysym_to_ucs (KeySym _xks);
 // static lglw_bool_t loc_touchkeyboard_get_rect (RECT *rect);
 // static lglw_bool_t loc_touchkeyboard_is_visible (void);
 extern lglw_bool_t lglw_int_touchkeyboard_toggle (void);
@@ -189,36 +713,144 @@ static void loc_handle_mouseenter (lglw_int_t *lglw);
 static void loc_handle_mousebutton (lglw_int_t *lglw, lglw_bool_t _bPressed, uint32_t _button);
 static void loc_handle_mousemotion (lglw_int_t *lglw);
 static void loc_handle_queued_mouse_warp (lglw_int_t *lglw);
+static void loc_handle_xmotion (lglw_int_t *lglw, XMotionEvent *_motion);
+static void loc_handle_mouse_relative (lglw_int_t *lglw, float _dx, float _dy);
+static lglw_bool_t loc_xi2_raw_motion_select (lglw_int_t *lglw, lglw_bool_t _bEnable);
+static lglw_bool_t loc_pointer_barriers_create (lglw_int_t *lglw);
+static void loc_pointer_barriers_destroy (lglw_int_t *lglw);
+static void loc_handle_xi2_event (lglw_int_t *lglw, XGenericEventCookie *_cookie);
+#if LGLW_USE_XINPUT2
+static lglw_bool_t loc_xi2_source_is_absolute (lglw_int_t *lglw, int _sourceId);
+#endif // LGLW_USE_XINPUT2
 
 static void loc_enable_dropfiles (lglw_int_t *lglw, lglw_bool_t _bEnable);
+static void loc_cursor_update (lglw_int_t *lglw);
+static lglw_bool_t loc_handle_client_message (lglw_int_t *lglw, XClientMessageEvent *_ev);
+static void loc_xdnd_send (lglw_int_t *lglw, Window _dest, uint32_t _atomIdx, long _l1, long _l2, long _l3, long _l4);
+static Window loc_xdnd_find_target (lglw_int_t *lglw, int32_t _rootX, int32_t _rootY, uint32_t *_retVersion);
+static Window loc_xdnd_find_aware (lglw_int_t *lglw, Window _w, int32_t _rootX, int32_t _rootY, uint32_t *_retVersion);
+static void loc_drag_handle_motion (lglw_int_t *lglw, int32_t _rootX, int32_t _rootY, Time _time);
+static void loc_drag_handle_release (lglw_int_t *lglw, Time _time);
+static void loc_drag_send_position (lglw_int_t *lglw);
+static void loc_drag_drop (lglw_int_t *lglw);
+static void loc_drag_end (lglw_int_t *lglw);
+static void loc_drag_timeout_cbk (lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData);
+static lglw_bool_t loc_xdnd_source_offers_uri_list (lglw_int_t *lglw, XClientMessageEvent *_ev);
+static void loc_xdnd_handle_selection_notify (lglw_int_t *lglw, XSelectionEvent *_ev);
+static int loc_hex_nibble (char _c);
+static char **loc_decode_uri_list (const char *_data, uint32_t _numBytes, uint32_t *_retNumPaths);
+
+static lglw_bool_t loc_create_hidden_window (lglw_int_t *lglw, int32_t _w, int32_t _h);
+static void loc_destroy_hidden_window (lglw_int_t *lglw);
+static lglw_bool_t loc_realize (lglw_int_t *lglw);
+static lglw_display_cache_t *loc_display_cache_ref (const char *_displayName, const int *_attrib);
+static void loc_display_cache_unref (lglw_display_cache_t *_dcache);
+static lglw_display_cache_t *loc_display_cache_find (const char *_name, const int *_attrib, uint32_t _numAttribs);
+static lglw_display_cache_t *loc_display_cache_create (const char *_displayName, const char *_name, const int *_attrib, uint32_t _numAttribs);
+static void loc_display_cache_free (lglw_display_cache_t *_dcache);
+static Display *loc_display_cache_connection_get (lglw_display_cache_t *_dcache);
+static Display *loc_display_cache_shared_connection_get (lglw_display_cache_t *_dcache);
+static void loc_display_cache_connection_put (lglw_display_cache_t *_dcache, Display *_xdsp);
+
+static lglw_bool_t loc_window_map_add (Window _xwnd, lglw_int_t *lglw);
+static void loc_window_map_remove (Window _xwnd, lglw_int_t *lglw);
+static lglw_int_t *loc_window_map_find (Window _xwnd);
+static void loc_events_dispatch (Display *_xdsp);
+static void loc_shared_instance_add (lglw_int_t *lglw);
+static void loc_shared_instance_remove (lglw_int_t *lglw);
+static lglw_int_t *loc_shared_instance_next (uint64_t _serial);
+static lglw_int_t *loc_shared_instance_from_property (Display *_xdsp, Window _xwnd);
+
+static lglw_bool_t loc_event_fd_init (lglw_int_t *lglw);
+static void loc_event_fd_exit (lglw_int_t *lglw);
+static void loc_event_fd_add (lglw_int_t *lglw, int _fd);
+static void loc_event_wakeup (lglw_int_t *lglw);
+static void loc_event_wakeup_clear (lglw_int_t *lglw);
+
+static lglw_event_t *loc_event_queue_alloc (lglw_int_t *lglw, uint32_t _type);
 
 static void loc_eventProc (XEvent *xev, lglw_int_t *lglw);
 static void loc_XEventProc (void *_xevent);
-static void loc_setProperty (Display *_display, Window _window, const char *_name, void *_value);
-static void *loc_getProperty (Display *_display, Window _window, const char *_name);
-static void loc_setEventProc (Display *display, Window window);
+static void loc_setProperty (Display *_display, Window _window, Atom _atom, void *_value);
+static void *loc_getProperty (Display *_display, Window _window, Atom _atom);
+static void loc_setEventProc (Display *display, Window window, Atom _atom);
+static Atom loc_display_atom_get (Display *_display, uint32_t _atomIdx);
+
+static void loc_clipboard_request_finish (lglw_int_t *lglw, uint32_t _status, const void *_data, uint32_t _numBytes);
+static void loc_clipboard_request_timeout_cbk (lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData);
+static void loc_handle_selection_notify (lglw_int_t *lglw, XSelectionEvent *_ev);
+static void loc_handle_selection_request (lglw_int_t *lglw, XSelectionRequestEvent *_ev);
+static void loc_handle_property_notify (lglw_int_t *lglw, XPropertyEvent *_ev);
+static lglw_bool_t loc_clipboard_send_property_deleted (lglw_int_t *lglw, XPropertyEvent *_ev);
+static lglw_bool_t loc_clipboard_send_has_requestor (lglw_int_t *lglw, Window _requestor);
+static lglw_bool_t loc_clipboard_send_is_requestor (lglw_int_t *lglw, Window _requestor);
+static void loc_clipboard_request_restart_timeout (lglw_int_t *lglw);
+static void loc_clipboard_receive_chunk (lglw_int_t *lglw);
+static uint32_t loc_clipboard_chunk_size (lglw_int_t *lglw);
+static lglw_bool_t loc_clipboard_send_begin (lglw_int_t *lglw, Atom _selection, Window _requestor, Atom _property, Atom _type, const char *_data, uint32_t _numBytes);
+static void loc_clipboard_send_next (lglw_int_t *lglw, lglw_clipboard_send_t *_send);
+static void loc_clipboard_send_end (lglw_int_t *lglw, lglw_clipboard_send_t *_send);
+static void loc_clipboard_send_abort (lglw_int_t *lglw, Atom _selectionOrNone);
+static void loc_clipboard_send_timeout_cbk (lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData);
+static lglw_bool_t loc_clipboard_provider_install (lglw_int_t *lglw, const char **_mimeTypes, lglw_clipboard_provider_fxn_t _cbk);
+static void loc_clipboard_provider_release (lglw_int_t *lglw);
+static lglw_bool_t loc_selection_provider_init (lglw_int_t *lglw, lglw_selection_provider_t *_provider, const char **_mimeTypes, lglw_clipboard_provider_fxn_t _cbk);
+static lglw_clipboard_provider_fxn_t loc_selection_provider_free (lglw_selection_provider_t *_provider);
+static const void *loc_selection_provide (lglw_int_t *lglw, lglw_selection_provider_t *_provider, Atom _target, uint32_t *_retNumBytes);
+static const void *loc_clipboard_text_provider (lglw_t _lglw, const char *_mimeType, uint32_t *_retNumBytes);
+
+static uint64_t loc_time_ns (void);
+static void loc_event_time_update (lglw_int_t *lglw, XEvent *xev);
 
 static void loc_millisec_init (lglw_int_t *lglw);
 static uint32_t loc_millisec_delta (lglw_int_t *lglw);  // return millisec since init()
+static void loc_timer_arm (lglw_int_t *lglw, uint64_t _deadlineNS);
+static void loc_timer_heap_sift_up (lglw_int_t *lglw, uint32_t _idx);
+static void loc_timer_heap_sift_down (lglw_int_t *lglw, uint32_t _idx);
+static uint32_t loc_timer_add (lglw_int_t *lglw, uint64_t _deadlineNS, uint64_t _intervalNS, lglw_timer_ex_fxn_t _cbk, void *_userData);
+static void loc_timer_legacy_cbk (lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData);
+
+static lglw_bool_t loc_glx_has_extension (lglw_int_t *lglw, const char *_name);
+static GLXContext loc_share_group_ref (lglw_display_cache_t *_dcache);
+static void loc_share_group_unref (lglw_display_cache_t *_dcache);
+static void loc_glsync_init (void);
+static void loc_frame_sync (lglw_int_t *lglw);
+static uint64_t loc_randr_refresh_period_ns (lglw_int_t *lglw);
+static void loc_frame_timer_cbk (lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData);
+static void loc_frame_timer_start (lglw_int_t *lglw);
+static void loc_frame_timer_stop (lglw_int_t *lglw);
 static void loc_process_timer (lglw_int_t *lglw);
+static uint64_t loc_timer_timeout_ns (lglw_int_t *lglw);  // return nanosec until next timer callback is due
+
 
+// ---------------------------------------------------------------------------- loc_time_ns
+static uint64_t loc_time_ns(void) {
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+}
 
 // ---------------------------------------------------------------------------- lglw_millisec_init
 static void loc_millisec_init (lglw_int_t *lglw) {
-   gettimeofday(&lglw->timer.tv_start, 0);
+   lglw->timer.start_ns = loc_time_ns();
 }
 
 // ---------------------------------------------------------------------------- lglw_millisec_delta
 static uint32_t loc_millisec_delta (lglw_int_t *lglw) {
-   struct timeval c; gettimeofday(&c, 0);
-   const struct timeval*s =  &lglw->timer.tv_start;
-   return (uint32_t) ( (c.tv_sec-s->tv_sec)*1000 + (c.tv_usec-s->tv_usec)/1000 );
+   // (note) wraps around after ~49.7 days. use lglw_time_get_ns() for long running timestamps
+   return (uint32_t) ( (loc_time_ns() - lglw->timer.start_ns) / 1000000u );
 }
 
 
 // TODO: remove and/or improve debug logging for a debug build
 // ---------------------------------------------------------------------------- lglw_log
 static FILE *logfile;
+static pthread_once_t logfile_once = PTHREAD_ONCE_INIT;
+
+static void loc_logfile_open(void) {
+   // (note) shared by all instances, closed at process exit
+   logfile = fopen("/tmp/lglw_log.txt", "w");
+}
 
 void lglw_log(const char *logData, ...) {
    static char buf[16*1024]; 
@@ -246,19 +878,29 @@ static int xerror_handler(Display *display, XErrorEvent *error) {
 
 // ---------------------------------------------------------------------------- lglw_init
 lglw_t lglw_init(int32_t _w, int32_t _h) {
+   return lglw_init_ex(_w, _h, 0u/*flags*/);
+}
+
+
+// ---------------------------------------------------------------------------- lglw_init_ex
+lglw_t lglw_init_ex(int32_t _w, int32_t _h, uint32_t _flags) {
    lglw_int_t *lglw = malloc(sizeof(lglw_int_t));
 
    // TODO: remove/improve
-   logfile = fopen("/tmp/lglw_log.txt", "w");
+   pthread_once(&logfile_once, loc_logfile_open);
    XSetErrorHandler(xerror_handler);
    XInitThreads();  // fix GL crash, see <https://forum.juce.com/t/linux-vst-opengl-crash-because-xinitthreads-not-called/22821>
 
-   loc_millisec_init(lglw);
-
    if(NULL != lglw)
    {
       memset(lglw, 0, sizeof(lglw_int_t));
 
+      loc_millisec_init(lglw);
+
+      lglw->event.fd        = -1;
+      lglw->event.wakeup_fd = -1;
+      lglw->timer.fd        = -1;
+
       Dlog("lglw:lglw_init: 1\n");
       if(_w <= 16)
          _w = LGLW_DEFAULT_HIDDEN_W;
@@ -266,12 +908,28 @@ lglw_t lglw_init(int32_t _w, int32_t _h) {
       if(_h <= 16)
          _h = LGLW_DEFAULT_HIDDEN_H;
 
+      lglw->hidden.size.x = _w;
+      lglw->hidden.size.y = _h;
+      lglw->init_flags    = _flags;
+
+      lglw->keyboard.b_repeat = LGLW_TRUE;  // deliver auto-repeats like the other platforms (see lglw_keyboard_get_repeat_count())
+
       Dlog("lglw:lglw_init: 2\n");
-      if(!loc_create_hidden_window(lglw, _w, _h))
+      if(!loc_event_fd_init(lglw))
       {
+         loc_event_fd_exit(lglw);
          free(lglw);
          lglw = NULL;
       }
+      else if(0u == (_flags & LGLW_INIT_LAZY))
+      {
+         if(!loc_realize(lglw))
+         {
+            loc_event_fd_exit(lglw);
+            free(lglw);
+            lglw = NULL;
+         }
+      }
       Dlog("lglw:lglw_init: 3\n");
    }
 
@@ -289,11 +947,28 @@ void lglw_exit(lglw_t _lglw) {
    {
       Dlog("lglw:lglw_exit: 1\n");
 
+      // Release relative grab (pointer barriers, XI raw motion selection, loc_mouse_relative_owner)
+      //  (note) the connection may outlive the instance (display cache / LGLW_INIT_SHARED_DISPLAY)
+      lglw_mouse_ungrab(lglw);
+
+      if(loc_mouse_relative_owner == lglw)
+      {
+         // (note) e.g. touch input was enabled while grabbed (lglw_mouse_ungrab() does nothing then)
+         if(lglw->mouse.relative.b_raw)
+         {
+            (void)loc_xi2_raw_motion_select(lglw, LGLW_FALSE);
+            lglw->mouse.relative.b_raw = LGLW_FALSE;
+         }
+         loc_pointer_barriers_destroy(lglw);
+         loc_mouse_relative_owner = NULL;
+      }
+
+      loc_event_fd_exit(lglw);
+
       loc_destroy_hidden_window(lglw);
 
       Dlog("lglw:lglw_exit: 2\n");
 
-      fclose(logfile);
       free(lglw);
    }
 }
@@ -323,1924 +998,6009 @@ void *lglw_userdata_get(lglw_t _lglw) {
    return NULL;
 }
 
-// ---------------------------------------------------------------------------- lglw_userdata_get
+// ---------------------------------------------------------------------------- loc_create_gl
 void loc_create_gl(lglw_int_t *lglw) {
-   lglw->ctx = glXCreateContext(lglw->xdsp, lglw->vi, None, True);
-}
+   GLXContext shareCtx = NULL;
 
-// ---------------------------------------------------------------------------- lglw_userdata_get
-void loc_destroy_gl(lglw_int_t *lglw) {
-   if(NULL != lglw->xdsp && NULL != lglw->ctx)
+   lglw->ctx     = NULL;
+   lglw->gl_xdsp = lglw->xdsp;
+
+   if(loc_share_group.b_enable)
    {
-      glXMakeCurrent(lglw->xdsp, None, NULL);
-      glXDestroyContext(lglw->xdsp, lglw->ctx);
+      shareCtx = loc_share_group_ref(lglw->dcache);
+      lglw->b_share_group = (NULL != shareCtx);
+
+      // Contexts that share objects must be created on the connection of the root context
+      //  (note) with DRI3, each connection has its own DRM fd and screen, i.e. objects cannot be shared across connections.
+      //          the instance windows are created on the instance connection, but X resources are server-global.
+      if(lglw->b_share_group)
+         lglw->gl_xdsp = lglw->dcache->xdsp;
    }
-}
 
+   // Prefer a context that does not flush when it is released (GLX_ARB_context_flush_control).
+   //  Rebinding between lglw instances / the host context would otherwise cost an implicit glFlush() each time.
+   //  (note) buffer swaps still flush
+   if(loc_glx_has_extension(lglw, "GLX_ARB_context_flush_control") && loc_glx_has_extension(lglw, "GLX_ARB_create_context"))
+   {
+      PFNGLXCREATECONTEXTATTRIBSARBPROC glXCreateContextAttribsARB =
+         (PFNGLXCREATECONTEXTATTRIBSARBPROC) glXGetProcAddress((const GLubyte*)"glXCreateContextAttribsARB");
 
-// ---------------------------------------------------------------------------- loc_create_hidden_window
-static lglw_bool_t loc_create_hidden_window(lglw_int_t *lglw, int32_t _w, int32_t _h) {
+      if(NULL != glXCreateContextAttribsARB)
+      {
+         // Find FBConfig that matches the (glXChooseVisual()) visual
+         int numConfigs = 0;
+         GLXFBConfig *configs = glXGetFBConfigs(lglw->gl_xdsp, lglw->vi->screen, &numConfigs);
 
-   // TODO: compare to 'WindowClass' from Windows implementation
+         if(NULL != configs)
+         {
+            int i;
+            for(i = 0; i < numConfigs; i++)
+            {
+               int visualId = 0;
+               if( (Success == glXGetFBConfigAttrib(lglw->gl_xdsp, configs[i], GLX_VISUAL_ID, &visualId)) &&
+                   ((VisualID)visualId == lglw->vi->visualid)
+                   )
+               {
+                  static const int ctxAttribs[] = {
+                     GLX_CONTEXT_RELEASE_BEHAVIOR_ARB, GLX_CONTEXT_RELEASE_BEHAVIOR_NONE_ARB,
+                     None
+                  };
+                  lglw->ctx = glXCreateContextAttribsARB(lglw->gl_xdsp, configs[i], shareCtx, True/*direct*/, ctxAttribs);
+                  Dlog_v("lglw:loc_create_gl: created context with release_behavior=none. ctx=%p\n", lglw->ctx);
+                  break;
+               }
+            }
+            XFree(configs);
+         }
+      }
+   }
 
-   Dlog_v("lglw:loc_create_hidden_window: 1\n");
-   XSetWindowAttributes swa;
-   int attrib[] = { GLX_RGBA, GLX_DOUBLEBUFFER, GLX_DEPTH_SIZE, 24, None };
-   int screen;
+   if(NULL == lglw->ctx)
+   {
+      lglw->ctx = glXCreateContext(lglw->gl_xdsp, lglw->vi, shareCtx, True);
+   }
 
-   Dlog_v("lglw:loc_create_hidden_window: 2\n");
-   lglw->xdsp = XOpenDisplay(NULL);
-   screen = DefaultScreen(lglw->xdsp);
+   if(NULL == lglw->ctx && lglw->b_share_group)
+   {
+      loc_share_group_unref(lglw->dcache);
+      lglw->b_share_group = LGLW_FALSE;
+      lglw->gl_xdsp       = lglw->xdsp;
+   }
+}
 
-   Dlog_v("lglw:loc_create_hidden_window: 3\n");
-   lglw->vi = glXChooseVisual(lglw->xdsp, screen, attrib);
+// ---------------------------------------------------------------------------- loc_destroy_gl
+void loc_destroy_gl(lglw_int_t *lglw) {
+   if(NULL != lglw->gl_xdsp && NULL != lglw->ctx)
+   {
+      glXMakeCurrent(lglw->gl_xdsp, None, NULL);
+      glXDestroyContext(lglw->gl_xdsp, lglw->ctx);
+      lglw->ctx = NULL;
+   }
 
-   Dlog_v("lglw:loc_create_hidden_window: 4\n");
-   if(NULL == lglw->vi)
+   if(lglw->b_share_group)
    {
-      Dlog("[---] lglw: failed to find GLX Visual for hidden window\n");
-      return LGLW_FALSE;
+      loc_share_group_unref(lglw->dcache);
+      lglw->b_share_group = LGLW_FALSE;
    }
 
-   Dlog_v("lglw:loc_create_hidden_window: 5\n");
-   loc_create_gl(lglw);
+   lglw->gl_xdsp = NULL;
+}
 
-   if(NULL == lglw->ctx)
+
+// ---------------------------------------------------------------------------- loc_share_group_ref
+//  Get share group root context of the given display (create on first use)
+//   (note) the root context is created on the cache connection, with the cached visual, i.e. all members
+//           (see loc_create_gl()) use the same connection and a compatible config
+static GLXContext loc_share_group_ref(lglw_display_cache_t *_dcache) {
+   GLXContext r = NULL;
+
+   pthread_mutex_lock(&loc_share_group.mtx);
+
+   if(NULL == _dcache->share_ctx)
    {
-      Dlog("lglw: FAILED to create context!!!\n");
+      // First user: create hidden root context
+      XVisualInfo viTemplate;
+      XVisualInfo *vi;
+      int numVi = 0;
+
+      viTemplate.visualid = _dcache->visualid;
+      viTemplate.screen   = _dcache->screen;
+      vi = XGetVisualInfo(_dcache->xdsp, VisualIDMask | VisualScreenMask, &viTemplate, &numVi);
+
+      if(NULL != vi)
+      {
+         _dcache->share_ctx = glXCreateContext(_dcache->xdsp, vi, None, True/*direct*/);
+         XFree(vi);
+      }
+
+      if(NULL == _dcache->share_ctx)
+      {
+         Dlog("[---] lglw:loc_share_group_ref: failed to create share group root context\n");
+      }
+      else
+      {
+         Dlog_v("lglw:loc_share_group_ref: created share group root context=%p display=\"%s\"\n", _dcache->share_ctx, _dcache->name);
+      }
    }
 
-   Dlog_v("lglw:loc_create_hidden_window: 6\n");
-   if(NULL == lglw->ctx)
+   if(NULL != _dcache->share_ctx)
    {
-      Dlog("[---] lglw: failed to create GLX Context for hidden window\n");
-      return LGLW_FALSE;
+      _dcache->share_ref_count++;
+      r = _dcache->share_ctx;
    }
 
-   Dlog_v("lglw:loc_create_hidden_window: 7\n");
-   lglw->cmap = XCreateColormap(lglw->xdsp, RootWindow(lglw->xdsp, lglw->vi->screen),
-                                lglw->vi->visual, AllocNone);
-
-   Dlog_v("lglw:loc_create_hidden_window: 8\n");
-   swa.border_pixel = 0;
-   swa.colormap = lglw->cmap;
-   lglw->hidden.xwnd = XCreateWindow(lglw->xdsp, DefaultRootWindow(lglw->xdsp),
-                                     0, 0, LGLW_DEFAULT_HIDDEN_W, LGLW_DEFAULT_HIDDEN_H, 0, CopyFromParent, InputOutput,
-                                     lglw->vi->visual, CWBorderPixel | CWColormap, &swa);
+   pthread_mutex_unlock(&loc_share_group.mtx);
 
-   Dlog_v("lglw:loc_create_hidden_window: 9\n");
-   XSetStandardProperties(lglw->xdsp, lglw->hidden.xwnd, "LGLW_hidden", "LGLW_hidden", None, NULL, 0, NULL);
-   XSync(lglw->xdsp, False);
+   return r;
+}
 
-   Dlog_v("lglw:loc_create_hidden_window: EXIT\n");
-   lglw->hidden.size.x = _w;
-   lglw->hidden.size.y = _h;
 
-   return LGLW_TRUE;
-}
+// ---------------------------------------------------------------------------- loc_share_group_unref
+static void loc_share_group_unref(lglw_display_cache_t *_dcache) {
+   pthread_mutex_lock(&loc_share_group.mtx);
 
+   if(_dcache->share_ref_count > 0u)
+   {
+      if(0u == --_dcache->share_ref_count)
+      {
+         // Last user: shared GL objects are released together with the root context
+         Dlog_v("lglw:loc_share_group_unref: destroy share group root context=%p\n", _dcache->share_ctx);
 
-// ---------------------------------------------------------------------------- loc_destroy_hidden_window
-static void loc_destroy_hidden_window(lglw_int_t *lglw) {
-   Dlog_v("lglw:loc_destroy_hidden_window: 1\n");
-   loc_destroy_gl(lglw);
-   Dlog_v("lglw:loc_destroy_hidden_window: 2\n");
-   if(NULL != lglw->xdsp && 0 != lglw->hidden.xwnd) XDestroyWindow(lglw->xdsp, lglw->hidden.xwnd);
-   Dlog_v("lglw:loc_destroy_hidden_window: 3\n");
-   if(NULL != lglw->xdsp && 0 != lglw->cmap) XFreeColormap(lglw->xdsp, lglw->cmap);
-   Dlog_v("lglw:loc_destroy_hidden_window: 4\n");
-   if(NULL != lglw->vi) XFree(lglw->vi);
+         glXDestroyContext(_dcache->xdsp, _dcache->share_ctx);
+         _dcache->share_ctx = NULL;
+      }
+   }
 
-   Dlog_v("lglw:loc_destroy_hidden_window: 5\n");
-   XSync(lglw->xdsp, False);
-   if(NULL != lglw->xdsp) XCloseDisplay(lglw->xdsp);
+   pthread_mutex_unlock(&loc_share_group.mtx);
 }
 
 
-// ---------------------------------------------------------------------------- loc_setEventProc
-// https://www.kvraudio.com/forum/viewtopic.php?t=387924
-// https://github.com/Ardour/ardour/blob/master/gtk2_ardour/linux_vst_gui_support.cc
-// https://discourse.ardour.org/t/overtonedsp-plugins/90115/22
-// https://github.com/amsynth/amsynth/blob/4a87798e650c6d71d70274a961c9b8d98fc6da7e/src/amsynth_vst.cpp
-// https://github.com/rsenn/eXT2/blob/7f00a09561ded8175ffed2f4912dad74e466a1c7/vstplugins/vstgui/vstgui.cpp
-// https://github.com/COx2/DistortionFilter/blob/c6a34fb56b503a6e95bf0975e00f438bbf4ff52a/juce/modules/juce_audio_processors/format_types/juce_VSTPluginFormat.cpp
-
-// Very simple function to test _XEventProc is properly called
-static void loc_eventProc(XEvent *xev, lglw_int_t *lglw) {
+// ---------------------------------------------------------------------------- lglw_glcontext_share_group_set
+void lglw_glcontext_share_group_set(lglw_bool_t _bEnable) {
+   pthread_mutex_lock(&loc_share_group.mtx);
+   loc_share_group.b_enable = _bEnable;
+   pthread_mutex_unlock(&loc_share_group.mtx);
+}
 
-   Dlog_vvv("lglw:loc_eventProc: type=%d serial=%lu send_event=%d lglw=%p\n", xev->xany.type, xev->xany.serial, xev->xany.send_event, lglw);
 
-   loc_process_timer(lglw);
+// ---------------------------------------------------------------------------- lglw_glcontext_share_group_get
+lglw_bool_t lglw_glcontext_share_group_get(lglw_t _lglw) {
+   LGLW(_lglw);
 
    if(NULL != lglw)
    {
-      lglw_bool_t eventHandled = LGLW_FALSE;
+      return lglw->b_share_group;
+   }
 
-      switch(xev->type)
-      {
-         default:
-            Dlog("lglw:loc_eventProc: unhandled X11 event type=%d\n", xev->type);
-            eventHandled = LGLW_FALSE;
-            break;
+   return LGLW_FALSE;
+}
 
-         case Expose:
-            Dlog_vvv("lglw:loc_eventProc: xev Expose\n");
-            loc_handle_queued_mouse_warp(lglw);
-            eventHandled = LGLW_FALSE;
-            if(NULL != lglw->redraw.cbk)
-            {
-               lglw->redraw.cbk(lglw);
-               eventHandled = LGLW_TRUE;
-            }
-            break;
 
-            // TODO: Should FocusIn/Out be treated like WM_CAPTURECHANGED and reset the grab state?
+// ---------------------------------------------------------------------------- loc_display_cache_ref
+//  Find or create cache entry for the given display name and visual attribs
+//   The first instance pays for the XOpenDisplay() / glXChooseVisual() / XCreateColormap() / XInternAtoms()
+//   round trips, later instances just look up the visual (client-side) and reuse the colormap and atoms.
+//   (note) the cache connection is also the instance connection of the first instance (no extra connection).
+//           LGLW_INIT_SHARED_DISPLAY instances share it, other instances need a connection of their own
+//           (a parked connection of an exited instance, if available. see loc_display_cache_connection_get()).
+//   (note) new entries are created outside of the cache lock, i.e. a slow (or dead) server does not block
+//           other threads that create or destroy instances
+static lglw_display_cache_t *loc_display_cache_ref(const char *_displayName, const int *_attrib) {
+   lglw_display_cache_t *r;
+   lglw_display_cache_t *n;
+   const char *name = XDisplayName(_displayName);
+   uint32_t numAttribs = 0u;
+
+   while(None != _attrib[numAttribs])
+   {
+      if(++numAttribs >= LGLW_DISPLAY_CACHE_MAX_ATTRIBS)
+      {
+         Dlog("[---] lglw:loc_display_cache_ref: too many visual attribs\n");
+         return NULL;
+      }
+   }
 
-         case FocusIn:
-            Dlog_v("lglw:loc_eventProc: xev FocusIn\n");
-            eventHandled = LGLW_FALSE;
-            break;
+   pthread_mutex_lock(&loc_display_cache.mtx);
 
-         case FocusOut:
-            Dlog_v("lglw:loc_eventProc: xev FocusOut\n");
-            eventHandled = LGLW_FALSE;
-            break;
+   r = loc_display_cache_find(name, _attrib, numAttribs);
 
-         case EnterNotify:
-            // Dlog_v("lglw:loc_eventProc: xev XEnterWindowEvent\n");
-            ; // empty statement
-            XEnterWindowEvent *wenter = (XEnterWindowEvent*)xev;
-            Dlog_v("lglw:loc_eventProc: xev EnterNotify: mode:%i, detail:%i, state:%d\n", wenter->mode, wenter->detail, wenter->state);
-            lglw->mouse.p.x = wenter->x;
-            lglw->mouse.p.y = wenter->y;
-            loc_handle_mousemotion(lglw);
+   if(NULL != r)
+      r->ref_count++;
 
-            // EnterNotify messages can be pseudo-motion events (NotifyGrab, NotifyUngrab)
-            // when buttons are pressed, which would trigger false focus changes
-            // so, the callback is only sent when a normal entry happens
-            if (wenter->mode == NotifyNormal)
-            {
-               loc_handle_mouseenter(lglw);
-            }
-            eventHandled = LGLW_TRUE;
+   pthread_mutex_unlock(&loc_display_cache.mtx);
 
-            break;
+   if(NULL != r)
+      return r;
 
-         case LeaveNotify:
-            // Dlog_v("lglw:loc_eventProc: xev XLeaveWindowEvent\n");
-            ; // empty statement
-            XLeaveWindowEvent *wexit = (XLeaveWindowEvent*)xev;
-            Dlog_v("lglw:loc_eventProc: xev LeaveNotify: mode:%i, detail:%i, state:%d\n", wexit->mode, wexit->detail, wexit->state);
+   n = loc_display_cache_create(_displayName, name, _attrib, numAttribs);
 
-            // LeaveNotify messages can be pseudo-motion events (NotifyGrab, NotifyUngrab)
-            // when buttons are pressed, which would trigger false focus changes
-            // so, the callback is only sent when a normal entry happens
-            if (wexit->mode == NotifyNormal)
-            {
-               loc_handle_mouseleave(lglw);
-            }
-            eventHandled = LGLW_TRUE;
+   if(NULL == n)
+      return NULL;
 
-            break;
+   pthread_mutex_lock(&loc_display_cache.mtx);
 
-         case MotionNotify:
-            Dlog_vvv("lglw:loc_eventProc: xev MotionNotify\n");
-            ; // empty statement
-            XMotionEvent *motion = (XMotionEvent*)xev;
+   // Another thread may have added an entry for the same display in the meantime
+   r = loc_display_cache_find(name, _attrib, numAttribs);
 
-            if(LGLW_MOUSE_GRAB_WARP == lglw->mouse.grab.mode)
-            {
-               lglw->mouse.grab.b_queue_warp = LGLW_TRUE;
+   if(NULL == r)
+   {
+      n->next = loc_display_cache.first;
+      loc_display_cache.first = n;
+      r = n;
+      n = NULL;
 
-               lglw->mouse.p.x += (motion->x - lglw->mouse.grab.last_p.x);
-               lglw->mouse.p.y += (motion->y - lglw->mouse.grab.last_p.y);
+      Dlog_v("lglw:loc_display_cache_ref: new entry display=\"%s\" visualid=0x%lx cmap=0x%lx\n", r->name, r->visualid, r->cmap);
+   }
 
-               lglw->mouse.grab.last_p.x = motion->x;
-               lglw->mouse.grab.last_p.y = motion->y;
-            }
-            else
-            {
-               lglw->mouse.p.x = motion->x;
-               lglw->mouse.p.y = motion->y;
-            }
+   r->ref_count++;
 
-            loc_handle_mousemotion(lglw);
-            eventHandled = LGLW_TRUE;
+   pthread_mutex_unlock(&loc_display_cache.mtx);
 
-            break;
+   if(NULL != n)
+      loc_display_cache_free(n);
 
-         case KeyPress:
-            Dlog("lglw:loc_eventProc: xev KeyPress\n");
-            XKeyPressedEvent *keyPress = (XKeyPressedEvent*)xev;
+   return r;
+}
 
-            eventHandled = LGLW_FALSE;
-            KeySym xkp = XLookupKeysym(keyPress, 0);
-            switch(xkp)
-            {
-               default:
-                  Dlog("lglw:loc_eventProc: xev KeyPress: %x or %lu\n", keyPress->keycode, xkp);
-                  if(0u != (lglw->keyboard.kmod_state & LGLW_KMOD_SHIFT))
-                  {
-                     KeySym xkpl;
-                     KeySym xkpu;
-                     XConvertCase(xkp, &xkpl, &xkpu);
-                     eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, xkpu);
-                  }
-                  else
-                  {
-                     eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, xkp);
-                  }
-                  break;
 
-               case NoSymbol:
-                  Dlog("lglw:loc_eventProc: xev UNKNOWN KeyPress: %x\n", keyPress->keycode);
-                  break;
+// ---------------------------------------------------------------------------- loc_display_cache_unref
+static void loc_display_cache_unref(lglw_display_cache_t *_dcache) {
+   lglw_bool_t bFree = LGLW_FALSE;
 
-               case XK_Left:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_LEFT);
-                  break;
+   pthread_mutex_lock(&loc_display_cache.mtx);
 
-               case XK_Right:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_RIGHT);
-                  break;
+   if(0u == --_dcache->ref_count)
+   {
+      lglw_display_cache_t **pp = &loc_display_cache.first;
 
-               case XK_Up:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_UP);
-                  break;
+      while(*pp != _dcache)
+         pp = &(*pp)->next;
 
-               case XK_Down:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_DOWN);
-                  break;
+      *pp = _dcache->next;
+      bFree = LGLW_TRUE;
+   }
 
-               case XK_Insert:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_INSERT);
-                  break;
+   pthread_mutex_unlock(&loc_display_cache.mtx);
 
-               case XK_Delete:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_DELETE);
-                  break;
+   if(bFree)
+   {
+      Dlog_v("lglw:loc_display_cache_unref: free entry display=\"%s\"\n", _dcache->name);
+      loc_display_cache_free(_dcache);
+   }
+}
 
-               case XK_Home:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_HOME);
-                  break;
 
-               case XK_End:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_END);
-                  break;
+// ---------------------------------------------------------------------------- loc_display_cache_find
+//  (note) caller must hold loc_display_cache.mtx
+static lglw_display_cache_t *loc_display_cache_find(const char *_name, const int *_attrib, uint32_t _numAttribs) {
+   lglw_display_cache_t *r;
 
-               case XK_Prior:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_PAGEUP);
-                  break;
+   for(r = loc_display_cache.first; NULL != r; r = r->next)
+   {
+      if( (0 == strcmp(r->name, _name)) && (0 == memcmp(r->attrib, _attrib, sizeof(int) * (_numAttribs + 1u))) )
+         break;
+   }
 
-               case XK_Next:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_PAGEDOWN);
-                  break;
+   return r;
+}
 
-               case XK_F1:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F1);
-                  break;
 
-               case XK_F2:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F2);
-                  break;
+// ---------------------------------------------------------------------------- loc_display_cache_create
+//  Open cache connection, choose visual, create colormap and resolve atoms (not linked, yet)
+static lglw_display_cache_t *loc_display_cache_create(const char *_displayName, const char *_name, const int *_attrib, uint32_t _numAttribs) {
+   lglw_display_cache_t *r = malloc(sizeof(lglw_display_cache_t));
 
-               case XK_F3:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F3);
-                  break;
+   if(NULL != r)
+   {
+      XVisualInfo *vi = NULL;
 
-               case XK_F4:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F4);
-                  break;
+      memset(r, 0, sizeof(lglw_display_cache_t));
+      memcpy(r->attrib, _attrib, sizeof(int) * (_numAttribs + 1u));
+      r->name = strdup(_name);
+      r->xdsp = XOpenDisplay(_displayName);
 
-               case XK_F5:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F5);
-                  break;
+      if(NULL != r->xdsp)
+      {
+         r->screen = DefaultScreen(r->xdsp);
+         vi = glXChooseVisual(r->xdsp, r->screen, r->attrib);
+      }
 
-               case XK_F6:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F6);
-                  break;
+      if(NULL == vi || NULL == r->name)
+      {
+         Dlog("[---] lglw:loc_display_cache_create: failed to open display \"%s\" or to find GLX visual\n", _name);
 
-               case XK_F7:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F7);
-                  break;
+         if(NULL != vi)
+            XFree(vi);
 
-               case XK_F8:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F8);
-                  break;
+         if(NULL != r->xdsp)
+            XCloseDisplay(r->xdsp);
 
-               case XK_F9:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F9);
-                  break;
+         free(r->name);
+         free(r);
+         r = NULL;
+      }
+      else
+      {
+         r->visualid = vi->visualid;
+         r->cmap = XCreateColormap(r->xdsp, RootWindow(r->xdsp, r->screen), vi->visual, AllocNone);
+         XFree(vi);
 
-               case XK_F10:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F10);
-                  break;
+         // Resolve all atoms in a single round trip
+         //  (note) atoms are server-global, i.e. the values are valid on all connections to this display
+         if(!XInternAtoms(r->xdsp, loc_atom_names, LGLW_NUM_ATOMS, False/*only_if_exists*/, r->atoms))
+         {
+            Dlog("[---] lglw:loc_display_cache_create: XInternAtoms() failed\n");
+         }
 
-               case XK_F11:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F11);
-                  break;
+         // Make sure the colormap exists before other connections refer to it
+         XSync(r->xdsp, False);
+      }
+   }
 
-               case XK_F12:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_F12);
-                  break;
+   return r;
+}
 
-               case XK_BackSpace:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_BACKSPACE);
-                  break;
 
-               case XK_Tab:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_TAB);
-                  break;
+// ---------------------------------------------------------------------------- loc_display_cache_free
+//  (note) entry must not be linked (anymore)
+static void loc_display_cache_free(lglw_display_cache_t *_dcache) {
+   uint32_t i;
 
-               case XK_Return:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_RETURN);
-                  break;
+   for(i = 0u; i < LGLW_NUM_CURSORS; i++)
+   {
+      if(None != _dcache->cursors[i])
+         XFreeCursor(_dcache->xdsp, _dcache->cursors[i]);
+   }
 
-               case XK_Escape:
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_ESCAPE);
-                  break;
+   while(_dcache->num_idle > 0u)
+      XCloseDisplay(_dcache->idle_xdsp[--_dcache->num_idle]);
 
-               case XK_Shift_L:
-                  lglw->keyboard.kmod_state |= LGLW_KMOD_LSHIFT;
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_LSHIFT);
-                  eventHandled = LGLW_FALSE;
-                  break;
+   if( (NULL != _dcache->shared_xdsp) && (_dcache->shared_xdsp != _dcache->xdsp) )
+      XCloseDisplay(_dcache->shared_xdsp);
 
-               case XK_Shift_R:
-                  lglw->keyboard.kmod_state |= LGLW_KMOD_RSHIFT;
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_VKEY_RSHIFT);
-                  eventHandled = LGLW_FALSE;
-                  break;
+   XFreeColormap(_dcache->xdsp, _dcache->cmap);
+   XCloseDisplay(_dcache->xdsp);
+   free(_dcache->name);
+   free(_dcache);
+}
 
-               case XK_Control_L:
-                  lglw->keyboard.kmod_state |= LGLW_KMOD_LCTRL;
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_KMOD_LCTRL);
-                  eventHandled = LGLW_FALSE;
-                  break;
 
-               case XK_Control_R:
-                  lglw->keyboard.kmod_state |= LGLW_KMOD_RCTRL;
-                  eventHandled = loc_handle_key(lglw, LGLW_TRUE/*bPressed*/, LGLW_KMOD_RCTRL);
-                  eventHandled = LGLW_FALSE;
-                  break;
-            }
+// ---------------------------------------------------------------------------- loc_display_cache_connection_get
+//  Get private instance connection
+//   (note) the cache connection is lent to one private instance at a time, unless LGLW_INIT_SHARED_DISPLAY
+//           instances use it (private instances process all events of their connection, see lglw_events()).
+//           other private instances reuse parked connections, and only open a new one when none is left.
+static Display *loc_display_cache_connection_get(lglw_display_cache_t *_dcache) {
+   Display *r = NULL;
 
-            break;
+   pthread_mutex_lock(&loc_display_cache.mtx);
 
-         case KeyRelease:
-            Dlog("lglw:loc_eventProc: xev KeyRelease\n");
-            XKeyReleasedEvent *keyRelease = (XKeyReleasedEvent*)xev;
+   if( !_dcache->b_xdsp_lent && (_dcache->shared_xdsp != _dcache->xdsp) )
+   {
+      _dcache->b_xdsp_lent = LGLW_TRUE;
+      r = _dcache->xdsp;
+   }
+   else if(_dcache->num_idle > 0u)
+   {
+      r = _dcache->idle_xdsp[--_dcache->num_idle];
+   }
 
-            eventHandled = LGLW_FALSE;
-            KeySym xkr = XLookupKeysym(keyRelease, 0);
-            switch(xkr)
-            {
-               default:
-                  Dlog("lglw:loc_eventProc: xev KeyRelease: %x or %lu\n", keyRelease->keycode, xkr);
-                  if(0u != (lglw->keyboard.kmod_state & LGLW_KMOD_SHIFT))
-                  {
-                     KeySym xkrl;
-                     KeySym xkru;
-                     XConvertCase(xkr, &xkrl, &xkru);
-                     eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, xkru);
-                  }
-                  else
-                  {
-                     eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, xkr);
-                  }
-                  break;
+   pthread_mutex_unlock(&loc_display_cache.mtx);
 
-               case NoSymbol:
-                  Dlog("lglw:loc_eventProc: xev UNKNOWN KeyRelease: %x\n", keyRelease->keycode);
-                  break;
+   if(NULL == r)
+   {
+      r = XOpenDisplay(_dcache->name);
+   }
+   else
+   {
+      Dlog_v("lglw:loc_display_cache_connection_get: reuse connection %p (cache connection=%d)\n", r, (r == _dcache->xdsp));
+   }
 
-               case XK_Left:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_LEFT);
-                  break;
+   return r;
+}
 
-               case XK_Right:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_RIGHT);
-                  break;
 
-               case XK_Up:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_UP);
-                  break;
+// ---------------------------------------------------------------------------- loc_display_cache_shared_connection_get
+//  Get LGLW_INIT_SHARED_DISPLAY instance connection
+//   (note) this is the cache connection unless it has been lent to a private instance before the first shared instance was created
+static Display *loc_display_cache_shared_connection_get(lglw_display_cache_t *_dcache) {
+   Display *r;
+   Display *xdsp;
 
-               case XK_Down:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_DOWN);
-                  break;
+   pthread_mutex_lock(&loc_display_cache.mtx);
 
-               case XK_Insert:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_INSERT);
-                  break;
+   if( (NULL == _dcache->shared_xdsp) && !_dcache->b_xdsp_lent )
+      _dcache->shared_xdsp = _dcache->xdsp;
 
-               case XK_Delete:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_DELETE);
-                  break;
+   r = _dcache->shared_xdsp;
 
-               case XK_Home:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_HOME);
-                  break;
+   pthread_mutex_unlock(&loc_display_cache.mtx);
 
-               case XK_End:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_END);
-                  break;
+   if(NULL != r)
+      return r;
 
-               case XK_Prior:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_PAGEUP);
-                  break;
+   xdsp = XOpenDisplay(_dcache->name);
 
-               case XK_Next:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_PAGEDOWN);
-                  break;
+   if(NULL == xdsp)
+      return NULL;
 
-               case XK_F1:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F1);
-                  break;
+   pthread_mutex_lock(&loc_display_cache.mtx);
 
-               case XK_F2:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F2);
-                  break;
+   if(NULL == _dcache->shared_xdsp)
+   {
+      _dcache->shared_xdsp = xdsp;
+      xdsp = NULL;
+   }
 
-               case XK_F3:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F3);
-                  break;
+   r = _dcache->shared_xdsp;
 
-               case XK_F4:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F4);
-                  break;
+   pthread_mutex_unlock(&loc_display_cache.mtx);
 
-               case XK_F5:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F5);
-                  break;
+   if(NULL != xdsp)
+      XCloseDisplay(xdsp);
 
-               case XK_F6:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F6);
-                  break;
+   return r;
+}
 
-               case XK_F7:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F7);
-                  break;
 
-               case XK_F8:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F8);
-                  break;
+// ---------------------------------------------------------------------------- loc_display_cache_connection_put
+//  Park private instance connection for reuse by the next instance (or close it when the pool is full)
+//   (note) the instance must have destroyed its windows and GL context
+static void loc_display_cache_connection_put(lglw_display_cache_t *_dcache, Display *_xdsp) {
+   lglw_bool_t bParked = LGLW_FALSE;
 
-               case XK_F9:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F9);
-                  break;
+   // Wait until the server has processed the destroy requests and discard all events that are still queued
+   XSync(_xdsp, True/*discard*/);
 
-               case XK_F10:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F10);
-                  break;
+   pthread_mutex_lock(&loc_display_cache.mtx);
 
-               case XK_F11:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F11);
-                  break;
+   if(_xdsp == _dcache->xdsp)
+   {
+      // (note) the cache connection stays open until the entry is freed
+      _dcache->b_xdsp_lent = LGLW_FALSE;
+      bParked = LGLW_TRUE;
+   }
+   else if(_dcache->num_idle < LGLW_DISPLAY_CACHE_MAX_IDLE)
+   {
+      _dcache->idle_xdsp[_dcache->num_idle++] = _xdsp;
+      bParked = LGLW_TRUE;
+   }
 
-               case XK_F12:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_F12);
-                  break;
+   pthread_mutex_unlock(&loc_display_cache.mtx);
 
-               case XK_BackSpace:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_BACKSPACE);
-                  break;
+   if(!bParked)
+   {
+      XCloseDisplay(_xdsp);
+   }
+}
 
-               case XK_Tab:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_TAB);
-                  break;
 
-               case XK_Return:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_RETURN);
-                  break;
+// ---------------------------------------------------------------------------- loc_display_atom_get
+//  Get atom of a connection that may not belong to an lglw instance
+static Atom loc_display_atom_get(Display *_display, uint32_t _atomIdx) {
+   Atom r = None;
+   lglw_display_cache_t *dcache;
+   const char *name = DisplayString(_display);
 
-               case XK_Escape:
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_ESCAPE);
-                  break;
+   pthread_mutex_lock(&loc_display_cache.mtx);
 
-               case XK_Shift_L:
-                  lglw->keyboard.kmod_state &= ~LGLW_KMOD_LSHIFT;
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_LSHIFT);
-                  eventHandled = LGLW_FALSE;
-                  break;
+   for(dcache = loc_display_cache.first; NULL != dcache; dcache = dcache->next)
+   {
+      if( (dcache->xdsp == _display) || (dcache->shared_xdsp == _display) || (0 == strcmp(dcache->name, name)) )
+      {
+         r = dcache->atoms[_atomIdx];
+         break;
+      }
+   }
 
-               case XK_Shift_R:
-                  lglw->keyboard.kmod_state &= ~LGLW_KMOD_RSHIFT;
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_RSHIFT);
-                  eventHandled = LGLW_FALSE;
-                  break;
+   pthread_mutex_unlock(&loc_display_cache.mtx);
 
-               case XK_Control_L:
-                  lglw->keyboard.kmod_state &= ~LGLW_KMOD_LCTRL;
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_LCTRL);
-                  eventHandled = LGLW_FALSE;
-                  break;
+   if(None == r)
+   {
+      r = XInternAtom(_display, loc_atom_names[_atomIdx], False/*only_if_exists*/);
+   }
 
-               case XK_Control_R:
-                  lglw->keyboard.kmod_state &= ~LGLW_KMOD_RCTRL;
-                  eventHandled = loc_handle_key(lglw, LGLW_FALSE/*bPressed*/, LGLW_VKEY_RCTRL);
-                  eventHandled = LGLW_FALSE;
-                  break;
-            }
+   return r;
+}
 
-            break;
 
-         case ButtonPress:
-            Dlog("lglw:loc_eventProc: xev ButtonPress\n");
-            XButtonPressedEvent *btnPress = (XButtonPressedEvent*)xev;
-            lglw->mouse.p.x = btnPress->x;
-            lglw->mouse.p.y = btnPress->y;
+// ---------------------------------------------------------------------------- loc_create_hidden_window
+static lglw_bool_t loc_create_hidden_window(lglw_int_t *lglw, int32_t _w, int32_t _h) {
 
-            if(0u == (lglw->focus.state & LGLW_FOCUS_MOUSE))
-            {
-               loc_handle_mouseenter(lglw);
-            }
+   // TODO: compare to 'WindowClass' from Windows implementation
 
-            switch(btnPress->button)
-            {
-               default:
-                  Dlog("lglw:loc_eventProc: xev ButtonPress unhandled button: %i\n", btnPress->button);
-                  eventHandled = LGLW_FALSE;
-                  break;
-               case Button1:
-                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_LBUTTON);
-                  eventHandled = LGLW_TRUE;
-                  break;
-               case Button2:
-                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_MBUTTON);
-                  eventHandled = LGLW_TRUE;
-                  break;
-               case Button3:
-                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_RBUTTON);
-                  eventHandled = LGLW_TRUE;
-                  break;
-               case Button4:
-                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_WHEELUP);
-                  eventHandled = LGLW_TRUE;
-                  break;
-               case Button5:
-                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_WHEELDOWN);
-                  eventHandled = LGLW_TRUE;
-                  break;
-            }
-            break;
+   Dlog_v("lglw:loc_create_hidden_window: 1\n");
+   XSetWindowAttributes swa;
+   int attrib[] = { GLX_RGBA, GLX_DOUBLEBUFFER, GLX_DEPTH_SIZE, 24, None };
+   XVisualInfo viTemplate;
+   int numVi = 0;
 
-         case ButtonRelease:
-            Dlog("lglw:loc_eventProc: xev ButtonRelease\n");
-            XButtonReleasedEvent *btnRelease = (XButtonReleasedEvent*)xev;
-            lglw->mouse.p.x = btnRelease->x;
-            lglw->mouse.p.y = btnRelease->y;
-            switch(btnRelease->button)
-            {
-               default:
-                  Dlog("lglw:loc_eventProc: xev ButtonRelease unhandled button: %i\n", btnRelease->button);
-                  eventHandled = LGLW_FALSE;
-                  break;
-               case Button1:
-                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_LBUTTON);
-                  eventHandled = LGLW_TRUE;
-                  break;
-               case Button2:
-                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_MBUTTON);
-                  eventHandled = LGLW_TRUE;
-                  break;
-               case Button3:
-                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_RBUTTON);
-                  eventHandled = LGLW_TRUE;
-                  break;
-               case Button4:
-                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_WHEELUP);
-                  eventHandled = LGLW_TRUE;
-                  break;
-               case Button5:
-                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_WHEELDOWN);
-                  eventHandled = LGLW_TRUE;
-                  break;
-            }
-            break;
+   lglw->dcache = loc_display_cache_ref(NULL/*displayName*/, attrib);
 
-         case SelectionClear:
-            Dlog("lglw:loc_eventProc: xev SelectionClear\n");
-            lglw->clipboard.numChars = 0;
-            free(lglw->clipboard.data);
-            eventHandled = LGLW_TRUE;
-            break;
+   if(NULL == lglw->dcache)
+   {
+      return LGLW_FALSE;
+   }
 
-         case SelectionRequest:
-            Dlog("lglw:loc_eventProc: xev SelectionRequest\n");
-            XSelectionRequestEvent *cbReq = (XSelectionRequestEvent*)xev;
-            XSelectionEvent cbRes;
+   lglw->atoms = lglw->dcache->atoms;
 
-            Atom utf8 = XInternAtom(lglw->xdsp, "UTF8_STRING", False);
+   Dlog_v("lglw:loc_create_hidden_window: 2\n");
+   if(0u != (lglw->init_flags & LGLW_INIT_SHARED_DISPLAY))
+   {
+      lglw->xdsp = loc_display_cache_shared_connection_get(lglw->dcache);
 
-            cbRes.type = SelectionNotify;
-            cbRes.requestor = cbReq->requestor;
-            cbRes.selection = cbReq->selection;
-            cbRes.target = cbReq->target;
-            cbRes.time = cbReq->time;
+      if(NULL != lglw->xdsp)
+      {
+         lglw->b_shared_xdsp = LGLW_TRUE;
+         loc_shared_instance_add(lglw);
+      }
+   }
+   else
+   {
+      lglw->xdsp = loc_display_cache_connection_get(lglw->dcache);
+   }
 
-            if(cbReq->target == utf8)
-            {
-               XChangeProperty(lglw->xdsp, cbReq->requestor, cbReq->property, utf8, 8/*format*/, PropModeReplace,
-                               (unsigned char *)lglw->clipboard.data, lglw->clipboard.numChars);
+   if(NULL == lglw->xdsp)
+   {
+      Dlog("[---] lglw: failed to open display\n");
+      return LGLW_FALSE;
+   }
 
-               cbRes.property = cbReq->property;
-            }
-            else
-            {
-               cbRes.property = None;
-            }
+   // Held keys: only send KeyPress events while the key is repeating (no synthetic KeyRelease)
+   //  (note) per-client setting. when not supported, repeats are detected in loc_handle_xkey().
+   {
+      Bool bSupported = False;
+      XkbSetDetectableAutoRepeat(lglw->xdsp, True, &bSupported);
+      lglw->keyboard.b_detectable_repeat = (True == bSupported);
+      Dlog_v("lglw:loc_create_hidden_window: detectable auto-repeat=%d\n", lglw->keyboard.b_detectable_repeat);
+   }
 
-            XSendEvent(lglw->xdsp, cbReq->requestor, True, NoEventMask, (XEvent *)&cbRes);
-            eventHandled = LGLW_TRUE;
-
-            break;
-      }
+   Dlog_v("lglw:loc_create_hidden_window: 3\n");
+   // (note) XGetVisualInfo() is answered from the connection setup data (no round trip)
+   viTemplate.visualid = lglw->dcache->visualid;
+   viTemplate.screen   = lglw->dcache->screen;
+   lglw->vi = XGetVisualInfo(lglw->xdsp, VisualIDMask | VisualScreenMask, &viTemplate, &numVi);
 
-      if(LGLW_FALSE == eventHandled)
-      {
-         if(0 == lglw->parent_xwnd)
-         {
-            Dlog("lglw:loc_eventProc: no parent window to send events to\n");
-            XSendEvent(lglw->xdsp, InputFocus, True/*propgate*/, NoEventMask, xev);
-         }
-         else
-         {
-            Dlog("lglw:loc_eventProc: sending event %i to parent\n", xev->type);
-            XSendEvent(lglw->xdsp, lglw->parent_xwnd, True/*propgate*/, NoEventMask, xev);
-         }
-      }
+   Dlog_v("lglw:loc_create_hidden_window: 4\n");
+   if(NULL == lglw->vi)
+   {
+      Dlog("[---] lglw: failed to find GLX Visual for hidden window\n");
+      return LGLW_FALSE;
    }
-}
-
-static void loc_XEventProc(void *_xevent) {
-   XEvent *xev = (XEvent*)_xevent;
 
-   Dlog_vvv("lglw:loc_XEventProc: ENTER\n");
-   // Dlog_vvv("lglw: XEventProc, xev=%p\n", xev);
+   Dlog_v("lglw:loc_create_hidden_window: 5\n");
+   loc_create_gl(lglw);
 
-   if(NULL != xev)
+   if(NULL == lglw->ctx)
    {
-      LGLW(loc_getProperty(xev->xany.display, xev->xany.window, "_lglw"));  // get instance pointer
-      Dlog_vvv("lglw:loc_XEventProc: xev=%p lglw=%p\n", xev, lglw);
+      Dlog("lglw: FAILED to create context!!!\n");
+   }
 
-      loc_eventProc(xev, lglw);
+   Dlog_v("lglw:loc_create_hidden_window: 6\n");
+   if(NULL == lglw->ctx)
+   {
+      Dlog("[---] lglw: failed to create GLX Context for hidden window\n");
+      return LGLW_FALSE;
    }
 
-   Dlog_vvv("lglw:loc_XEventProc: LEAVE\n");
-}
+   Dlog_v("lglw:loc_create_hidden_window: 7\n");
+   lglw->cmap = lglw->dcache->cmap;
 
-static void loc_setProperty(Display *_display, Window _window, const char *_name, void *_value) {
-   size_t data = (size_t)_value;
-   long temp[2];
+   Dlog_v("lglw:loc_create_hidden_window: 8\n");
+   swa.border_pixel = 0;
+   swa.colormap = lglw->cmap;
+   lglw->hidden.xwnd = XCreateWindow(lglw->xdsp, DefaultRootWindow(lglw->xdsp),
+                                     0, 0, LGLW_DEFAULT_HIDDEN_W, LGLW_DEFAULT_HIDDEN_H, 0, CopyFromParent, InputOutput,
+                                     lglw->vi->visual, CWBorderPixel | CWColormap, &swa);
 
-   // Split the 64 bit pointer into a little-endian long array
-   temp[0] = (long)(data & 0xffffffffUL);
-   temp[1] = (long)(data >> 32L);
+   Dlog_v("lglw:loc_create_hidden_window: 9\n");
+   XSetStandardProperties(lglw->xdsp, lglw->hidden.xwnd, "LGLW_hidden", "LGLW_hidden", None, NULL, 0, NULL);
+
+   if(lglw->gl_xdsp != lglw->xdsp)
+   {
+      // Make sure the window exists before the context connection refers to it (share group member)
+      XSync(lglw->xdsp, False);
+   }
+   else
+   {
+      XFlush(lglw->xdsp);  // (note) requests are processed in order, no need to wait for the reply (XSync())
+   }
 
-   Dlog_v("lglw:loc_setProperty: name=\"%s\" value=%p temp[0]=%08x temp[1]=%08x\n", _name, _value, (uint32_t)temp[0], (uint32_t)temp[1]);
+   if(!loc_window_map_add(lglw->hidden.xwnd, lglw))
+   {
+      loc_setProperty(lglw->xdsp, lglw->hidden.xwnd, lglw->atoms[LGLW_ATOM_LGLW], (void*)lglw);  // set instance pointer (map is full)
+      XFlush(lglw->xdsp);
+   }
 
-   Atom atom = XInternAtom(_display, _name, False/*only_if_exists*/);
+   Dlog_v("lglw:loc_create_hidden_window: EXIT\n");
+   lglw->hidden.size.x = _w;
+   lglw->hidden.size.y = _h;
 
-   // (note) what's quite weird here is that we're writing an array of 32bit values, yet the element format must be 64bit (long)
-   XChangeProperty(_display, _window,
-                   atom/*property*/,
-                   atom/*type*/,
-                   32/*format*/,
-                   PropModeReplace/*mode*/,
-                   (unsigned char*)temp/*data*/,
-                   2/*nelements*/
-                   );
+   return LGLW_TRUE;
 }
 
-static void *loc_getProperty(Display *_display, Window _window, const char *_name) {
-   int userSize;
-   unsigned long bytes;
-   unsigned long userCount;
-   unsigned char *data;
-   Atom userType;
-   Atom atom = XInternAtom(_display, _name, False);
 
-   // (note) 64bit properties need to be read with two XGetWindowProperty() calls.
-   //         When using just one call and setting the 'length' to 2, the upper 32bit (second array element) will be 0xFFFFffff.
-   XGetWindowProperty(_display,
-                      _window,
-                      atom,
-                      0/*offset*/,
-                      1/*length*/,
-                      False/*delete*/,
-                      AnyPropertyType,
-                      &userType/*actual_type_return*/,
-                      &userSize/*actual_format_return*/,
-                      &userCount/*nitems_return*/,
-                      &bytes/*bytes_after_return / partial reads*/,
-                      &data);
+// ---------------------------------------------------------------------------- loc_destroy_hidden_window
+static void loc_destroy_hidden_window(lglw_int_t *lglw) {
+   Dlog_v("lglw:loc_destroy_hidden_window: 1\n");
+   loc_destroy_gl(lglw);
+   Dlog_v("lglw:loc_destroy_hidden_window: 2\n");
+   if(0 != lglw->hidden.xwnd) loc_window_map_remove(lglw->hidden.xwnd, lglw);
+   if(NULL != lglw->xdsp && 0 != lglw->hidden.xwnd) XDestroyWindow(lglw->xdsp, lglw->hidden.xwnd);
+   Dlog_v("lglw:loc_destroy_hidden_window: 3\n");
+   // (note) cmap is owned by the display cache
+   Dlog_v("lglw:loc_destroy_hidden_window: 4\n");
+   if(NULL != lglw->vi) XFree(lglw->vi);
 
-   union {
-      uint32_t ui[2];
-      void *any;
-   } uptr;
-   uptr.any = 0;
+   Dlog_v("lglw:loc_destroy_hidden_window: 5\n");
+   if(lglw->b_shared_xdsp)
+   {
+      // (note) connection is owned by the display cache
+      XFlush(lglw->xdsp);
 
-   Dlog_vvv("lglw:loc_getProperty: LOWER userSize=%d userCount=%lu bytes=%lu data=%p\n", userSize, userCount, bytes, data);
+      loc_shared_instance_remove(lglw);
+      lglw->b_shared_xdsp = LGLW_FALSE;
+   }
+   else if(NULL != lglw->xdsp)
+   {
+      if(NULL != lglw->dcache)
+         loc_display_cache_connection_put(lglw->dcache, lglw->xdsp);
+      else
+         XCloseDisplay(lglw->xdsp);
+   }
 
-   if(NULL != data)
+   if(NULL != lglw->dcache)
    {
-      if(userCount >= 1)
-      {
-         // lower 32-bit
-         uptr.ui[0] = *(long*)data;
-         uptr.ui[1] = 0;
+      loc_display_cache_unref(lglw->dcache);
+      lglw->dcache = NULL;
+   }
 
-         Dlog_vvv("lglw:loc_getProperty:    lower=0x%08x\n", uptr.ui[0]);
+   lglw->atoms       = NULL;
+   lglw->xdsp        = NULL;
+   lglw->vi          = NULL;
+   lglw->cmap        = 0;
+   lglw->hidden.xwnd = 0;
+}
 
-         XFree(data);
 
-         XGetWindowProperty(_display,
-                            _window,
-                            atom,
-                            1/*offset*/,
-                            1/*length*/,
-                            False/*delete*/,
-                            AnyPropertyType,
-                            &userType/*actual_type_return*/,
-                            &userSize/*actual_format_return*/,
-                            &userCount/*nitems_return*/,
-                            &bytes/*bytes_after_return / partial reads*/,
-                            &data);
+// ---------------------------------------------------------------------------- loc_realize
+//  Open display, create GL context and hidden window (unless this has already been done)
+static lglw_bool_t loc_realize(lglw_int_t *lglw) {
+   if(0 != lglw->hidden.xwnd)
+      return LGLW_TRUE;
 
-         Dlog_vvv("lglw:loc_getProperty: UPPER userSize=%d userCount=%lu bytes=%lu data=%p\n", userSize, userCount, bytes, data);
-         if(NULL != data)
-         {
-            // upper 32-bit
-            uptr.ui[1] = *(long*)data;
-            Dlog_vvv("lglw:loc_getProperty:    upper=0x%08x\n", uptr.ui[1]);
-            XFree(data);
-         }
-      }
+   Dlog_v("lglw:loc_realize: lglw=%p\n", lglw);
+
+   if(!loc_create_hidden_window(lglw, lglw->hidden.size.x, lglw->hidden.size.y))
+   {
+      Dlog("[---] lglw:loc_realize: failed to create hidden window\n");
+      loc_destroy_hidden_window(lglw);
+      return LGLW_FALSE;
    }
 
-   Dlog_vvv("lglw:loc_getProperty: return value=%p\n", uptr.any);
+   loc_event_fd_add(lglw, ConnectionNumber(lglw->xdsp));
 
-   return uptr.any;
+   return LGLW_TRUE;
 }
 
 
-#ifdef ARCH_X64
-#if 0
-// Pulled from the Renoise 64-bit callback example
-// Unsure what data was supposed to be, but swapping it to a function name did not work
-// This does nothing, no event proc found
-static void loc_setEventProc (Display *display, Window window) {
-   size_t data = (size_t)loc_eventProc;
-   long temp[2];
+// ---------------------------------------------------------------------------- loc_event_fd_init
+static lglw_bool_t loc_event_fd_init(lglw_int_t *lglw) {
 
-   Dlog("lglw: setEventProc (2*32bit). window=%lu loc_eventProc=%p\n", window, &loc_eventProc);
+   lglw->event.fd = epoll_create1(EPOLL_CLOEXEC);
+   if(-1 == lglw->event.fd)
+   {
+      Dlog("[---] lglw: failed to create epoll fd. errno=%d\n", errno);
+      return LGLW_FALSE;
+   }
 
-   // Split the 64 bit pointer into a little-endian unsigned int array
-   temp[0] = (uint32_t)(data & 0xffffffffUL);
-   temp[1] = (uint32_t)(data >> 32L);
+   lglw->event.wakeup_fd = eventfd(0u, EFD_NONBLOCK | EFD_CLOEXEC);
+   if(-1 == lglw->event.wakeup_fd)
+   {
+      Dlog("[---] lglw: failed to create wakeup eventfd. errno=%d\n", errno);
+      return LGLW_FALSE;
+   }
 
-   Atom atom = XInternAtom(display, "_XEventProc", False);
-   XChangeProperty(display, window,
-                   atom/*property*/,
-                   atom/*type*/,
-                   32/*format*/,
-                   PropModeReplace/*mode*/,
-                   (unsigned char*)temp/*data*/,
-                   2/*nelements*/
-                   );
-}
-#else
-// GPL code pulled from the amsynth example <https://github.com/amsynth/amsynth/blob/4a87798e650c6d71d70274a961c9b8d98fc6da7e/src/amsynth_vst.cpp>
-// Simply swapped out the function names, crashes Ardour in the same was as the others
-static void loc_setEventProc (Display *display, Window window) {
-   //
-   // JUCE calls XGetWindowProperty with long_length = 1 which means it only fetches the lower 32 bits of the address.
-   // Therefore we need to ensure we return an address in the lower 32-bits of address space.
-   //
+   lglw->timer.fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+   if(-1 == lglw->timer.fd)
+   {
+      Dlog("[---] lglw: failed to create timerfd. errno=%d\n", errno);
+      return LGLW_FALSE;
+   }
 
-   // based on mach_override
-   static const unsigned char kJumpInstructions[] = {
-         0xFF, 0x25, 0x00, 0x00, 0x00, 0x00,
-         0x00, 0x00, 0x00, 0x00,
-         0x00, 0x00, 0x00, 0x00
-   };
-   static const int kJumpAddress = 6;
+   loc_event_fd_add(lglw, lglw->event.wakeup_fd);
+   loc_event_fd_add(lglw, lglw->timer.fd);
 
-   static char *ptr = 0;
-   if (!ptr) {
-      ptr = (char *)mmap(0,
-                         getpagesize()/*PAGE_SIZE*/,
-                         PROT_READ | PROT_WRITE | PROT_EXEC,
-                         MAP_ANONYMOUS | MAP_PRIVATE | MAP_32BIT,
-                         0, 0);
-      if (ptr == MAP_FAILED) {
-         perror("mmap");
-         ptr = 0;
-         return;
-      } else {
-         memcpy(ptr, kJumpInstructions, sizeof(kJumpInstructions));
-         *((uint64_t *)(ptr + kJumpAddress)) = (uint64_t)(&loc_XEventProc);
-         msync(ptr, sizeof(kJumpInstructions), MS_INVALIDATE);
-         Dlog("lglw: 64bit trampoline installed\n");
-      }
-   }
+   // (note) the X connection fd is added by loc_realize()
 
-   long temp[2] = {(uint32_t)(((size_t)ptr)&0xFFFFfffful), 0};
-   Atom atom = XInternAtom(display, "_XEventProc", False);
-   XChangeProperty(display, window,
-                   atom/*property*/,
-                   atom/*type*/,
-                   32/*format*/,
-                   PropModeReplace/*mode*/,
-                   (unsigned char *)temp/*data*/,
-                   2/*nelements*/
-                   );
+   return LGLW_TRUE;
 }
-#endif
-#else
-// Pulled from the eXT2 example
-static void loc_setEventProc (Display *display, Window window) {
-   void* data = (void*)&loc_XEventProc; // swapped the function name here
 
-   // (note) 32-bit only
-   Atom atom = XInternAtom(display, "_XEventProc", False);
-   XChangeProperty(display, window,
-                   atom/*property*/,
-                   atom/*type*/,
-                   32/*format*/,
-                   PropModeReplace/*mode*/,
-                   (unsigned char*)&data/*data*/,
-                   1/*nelements*/
-                   );
-}
-#endif // ARCH_X64
 
+// ---------------------------------------------------------------------------- loc_event_fd_exit
+static void loc_event_fd_exit(lglw_int_t *lglw) {
+   if(-1 != lglw->timer.fd)
+   {
+      close(lglw->timer.fd);
+      lglw->timer.fd = -1;
+   }
 
-// ---------------------------------------------------------------------------- lglw_window_open
-lglw_bool_t lglw_window_open (lglw_t _lglw, void *_parentHWNDOrNull, int32_t _x, int32_t _y, int32_t _w, int32_t _h) {
-   lglw_bool_t r = LGLW_FALSE;
-   LGLW(_lglw);
+   if(-1 != lglw->event.wakeup_fd)
+   {
+      close(lglw->event.wakeup_fd);
+      lglw->event.wakeup_fd = -1;
+   }
 
-   if(NULL != lglw)
+   if(-1 != lglw->event.fd)
    {
-      Dlog_v("lglw:lglw_window_open: 1, %p, %i p=(%d; %d) s=(%d; %d)\n", (Window)_parentHWNDOrNull, (Window)_parentHWNDOrNull, _x, _y, _w, _h);
-      lglw->parent_xwnd = (0 == _parentHWNDOrNull) ? DefaultRootWindow(lglw->xdsp) : (Window)_parentHWNDOrNull;
+      close(lglw->event.fd);
+      lglw->event.fd = -1;
+   }
+}
 
-      Dlog_v("lglw:lglw_window_open: 2 lglw=%p\n", lglw);
-      if(_w <= 16)
-         _w = lglw->hidden.size.x;
 
-      Dlog_v("lglw:lglw_window_open: 3\n");
-      if(_h <= 16)
-         _h = lglw->hidden.size.y;
+// ---------------------------------------------------------------------------- loc_event_fd_add
+static void loc_event_fd_add(lglw_int_t *lglw, int _fd) {
+   struct epoll_event ev;
 
-      // TODO: compare to 'WindowClass' from Windows implementation
+   memset(&ev, 0, sizeof(ev));
+   ev.events  = EPOLLIN;
+   ev.data.fd = _fd;
+
+   if(-1 == epoll_ctl(lglw->event.fd, EPOLL_CTL_ADD, _fd, &ev))
+   {
+      Dlog("[---] lglw: epoll_ctl(ADD, fd=%d) failed. errno=%d\n", _fd, errno);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_event_wakeup
+static void loc_event_wakeup(lglw_int_t *lglw) {
+   if(-1 != lglw->event.wakeup_fd)
+   {
+      uint64_t one = 1u;
+      (void)write(lglw->event.wakeup_fd, &one, sizeof(one));
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_event_wakeup_clear
+static void loc_event_wakeup_clear(lglw_int_t *lglw) {
+   if(-1 != lglw->event.wakeup_fd)
+   {
+      uint64_t count;
+      (void)read(lglw->event.wakeup_fd, &count, sizeof(count));
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_setEventProc
+// https://www.kvraudio.com/forum/viewtopic.php?t=387924
+// https://github.com/Ardour/ardour/blob/master/gtk2_ardour/linux_vst_gui_support.cc
+// https://discourse.ardour.org/t/overtonedsp-plugins/90115/22
+// https://github.com/amsynth/amsynth/blob/4a87798e650c6d71d70274a961c9b8d98fc6da7e/src/amsynth_vst.cpp
+// https://github.com/rsenn/eXT2/blob/7f00a09561ded8175ffed2f4912dad74e466a1c7/vstplugins/vstgui/vstgui.cpp
+// https://github.com/COx2/DistortionFilter/blob/c6a34fb56b503a6e95bf0975e00f438bbf4ff52a/juce/modules/juce_audio_processors/format_types/juce_VSTPluginFormat.cpp
+
+// Very simple function to test _XEventProc is properly called
+static void loc_eventProc(XEvent *xev, lglw_int_t *lglw) {
+
+   Dlog_vvv("lglw:loc_eventProc: type=%d serial=%lu send_event=%d lglw=%p\n", xev->xany.type, xev->xany.serial, xev->xany.send_event, lglw);
+
+   if(NULL != lglw)
+   {
+      loc_process_timer(lglw);
+
+      lglw_bool_t eventHandled = LGLW_FALSE;
+
+      lglw->event.recv_ns = loc_time_ns();
+      loc_event_time_update(lglw, xev);
+
+      switch(xev->type)
+      {
+         default:
+            Dlog("lglw:loc_eventProc: unhandled X11 event type=%d\n", xev->type);
+            eventHandled = LGLW_FALSE;
+            break;
+
+         case Expose:
+            Dlog_vvv("lglw:loc_eventProc: xev Expose\n");
+            loc_handle_queued_mouse_warp(lglw);
+            eventHandled = LGLW_FALSE;
+            if(NULL != lglw->redraw.cbk)
+            {
+               lglw->redraw.cbk(lglw);
+               eventHandled = LGLW_TRUE;
+            }
+            break;
+
+            // TODO: Should FocusIn/Out be treated like WM_CAPTURECHANGED and reset the grab state?
+
+         case FocusIn:
+            Dlog_v("lglw:loc_eventProc: xev FocusIn\n");
+            eventHandled = LGLW_FALSE;
+            break;
+
+         case FocusOut:
+            Dlog_v("lglw:loc_eventProc: xev FocusOut\n");
+            // Key releases will not be seen while the window is not focused
+            memset(lglw->keyboard.down, 0, sizeof(lglw->keyboard.down));
+            eventHandled = LGLW_FALSE;
+            break;
+
+         case EnterNotify:
+            // Dlog_v("lglw:loc_eventProc: xev XEnterWindowEvent\n");
+            ; // empty statement
+            XEnterWindowEvent *wenter = (XEnterWindowEvent*)xev;
+            Dlog_v("lglw:loc_eventProc: xev EnterNotify: mode:%i, detail:%i, state:%d\n", wenter->mode, wenter->detail, wenter->state);
+            lglw->mouse.p.x = wenter->x;
+            lglw->mouse.p.y = wenter->y;
+            loc_handle_mousemotion(lglw);
+
+            // EnterNotify messages can be pseudo-motion events (NotifyGrab, NotifyUngrab)
+            // when buttons are pressed, which would trigger false focus changes
+            // so, the callback is only sent when a normal entry happens
+            if (wenter->mode == NotifyNormal)
+            {
+               loc_handle_mouseenter(lglw);
+            }
+            eventHandled = LGLW_TRUE;
+
+            break;
+
+         case LeaveNotify:
+            // Dlog_v("lglw:loc_eventProc: xev XLeaveWindowEvent\n");
+            ; // empty statement
+            XLeaveWindowEvent *wexit = (XLeaveWindowEvent*)xev;
+            Dlog_v("lglw:loc_eventProc: xev LeaveNotify: mode:%i, detail:%i, state:%d\n", wexit->mode, wexit->detail, wexit->state);
+
+            // LeaveNotify messages can be pseudo-motion events (NotifyGrab, NotifyUngrab)
+            // when buttons are pressed, which would trigger false focus changes
+            // so, the callback is only sent when a normal entry happens
+            if (wexit->mode == NotifyNormal)
+            {
+               loc_handle_mouseleave(lglw);
+            }
+            eventHandled = LGLW_TRUE;
+
+            break;
+
+         case MotionNotify:
+            Dlog_vvv("lglw:loc_eventProc: xev MotionNotify\n");
+            ; // empty statement
+            XMotionEvent *motion = (XMotionEvent*)xev;
+            lglw_vec2i_t motionStartP = lglw->mouse.p;
+
+            if(NULL != lglw->drag.provider.cbk)
+            {
+               // (note) pointer is grabbed by lglw_drag_begin(), coordinates are relative to our window
+               int32_t rootX = motion->x_root;
+               int32_t rootY = motion->y_root;
+               Time    t     = motion->time;
+
+               // Only the latest position matters (skip directly following motion events that are already queued)
+               if(motion->display == lglw->xdsp)
+               {
+                  XEvent xevNext;
+                  while(XEventsQueued(lglw->xdsp, QueuedAlready) > 0)
+                  {
+                     XPeekEvent(lglw->xdsp, &xevNext);
+                     if( (MotionNotify != xevNext.type) || (xevNext.xmotion.window != motion->window) )
+                        break;
+                     XNextEvent(lglw->xdsp, &xevNext);
+                     rootX = xevNext.xmotion.x_root;
+                     rootY = xevNext.xmotion.y_root;
+                     t     = xevNext.xmotion.time;
+                  }
+                  lglw->event.server_time = (uint32_t)t;
+               }
+
+               loc_drag_handle_motion(lglw, rootX, rootY, t);
+               eventHandled = LGLW_TRUE;
+               break;
+            }
+
+            if(LGLW_MOUSE_GRAB_RELATIVE == lglw->mouse.grab.mode)
+            {
+               // (note) absolute positions are meaningless while the (hidden) pointer is pinned to the window edge
+               // (note) motion events that the server generated before it processed the last re-centering warp are
+               //         skipped (their positions are not relative to the window center)
+               if(lglw->mouse.relative.b_raw && !lglw->mouse.relative.b_raw_absolute)
+               {
+                  // (note) keep track of the pointer position in case an absolute device takes over
+                  lglw->mouse.grab.last_p.x = motion->x;
+                  lglw->mouse.grab.last_p.y = motion->y;
+               }
+               else if(motion->serial >= lglw->mouse.relative.warp_serial)
+               {
+                  // Fallback (no XInput >= 2.1, or absolute pointer device): core motion delta
+                  //  (note) the pointer is only warped back to the window center when it gets close to the window edge
+                  int32_t dx = motion->x - lglw->mouse.grab.last_p.x;
+                  int32_t dy = motion->y - lglw->mouse.grab.last_p.y;
+
+                  if( (0 != dx) || (0 != dy) )
+                  {
+                     int32_t mx = lglw->win.size.x >> 2;
+                     int32_t my = lglw->win.size.y >> 2;
+
+                     lglw->mouse.grab.last_p.x = motion->x;
+                     lglw->mouse.grab.last_p.y = motion->y;
+                     loc_handle_mouse_relative(lglw, (float)dx, (float)dy);
+
+                     if( (motion->x < mx) || (motion->x >= (lglw->win.size.x - mx)) ||
+                         (motion->y < my) || (motion->y >= (lglw->win.size.y - my))
+                         )
+                     {
+                        lglw->mouse.grab.last_p.x = lglw->win.size.x >> 1;
+                        lglw->mouse.grab.last_p.y = lglw->win.size.y >> 1;
+                        lglw->mouse.relative.warp_serial = NextRequest(lglw->xdsp);
+                        lglw_mouse_warp(lglw, lglw->mouse.grab.last_p.x, lglw->mouse.grab.last_p.y);
+                     }
+                  }
+               }
+               eventHandled = LGLW_TRUE;
+               break;
+            }
+
+            loc_handle_xmotion(lglw, motion);
+            lglw->mouse.motion.num_merged = 1u;
+
+            if(lglw->mouse.motion.b_coalesce && (motion->display == lglw->xdsp))
+            {
+               // Merge directly following motion events (same window) that are already queued.
+               //  Stops at any other event type so that button transitions are still seen in order.
+               XEvent xevNext;
+               while(XEventsQueued(lglw->xdsp, QueuedAlready) > 0)
+               {
+                  XPeekEvent(lglw->xdsp, &xevNext);
+                  if( (MotionNotify != xevNext.type) || (xevNext.xmotion.window != motion->window) )
+                     break;
+                  XNextEvent(lglw->xdsp, &xevNext);
+                  loc_handle_xmotion(lglw, &xevNext.xmotion);
+                  lglw->event.server_time = (uint32_t)xevNext.xmotion.time;
+                  lglw->mouse.motion.num_merged++;
+               }
+               Dlog_vvv("lglw:loc_eventProc: xev MotionNotify: merged %u events\n", lglw->mouse.motion.num_merged);
+            }
+
+            lglw->mouse.motion.delta.x = lglw->mouse.p.x - motionStartP.x;
+            lglw->mouse.motion.delta.y = lglw->mouse.p.y - motionStartP.y;
+
+            loc_handle_mousemotion(lglw);
+            lglw->mouse.motion.num_merged = 0u;
+            lglw->mouse.motion.delta.x = 0;
+            lglw->mouse.motion.delta.y = 0;
+            eventHandled = LGLW_TRUE;
+
+            break;
+
+         case KeyPress:
+         case KeyRelease:
+            Dlog("lglw:loc_eventProc: xev %s\n", (KeyPress == xev->type) ? "KeyPress" : "KeyRelease");
+            eventHandled = loc_handle_xkey(lglw, &xev->xkey);
+            break;
+
+         case ButtonPress:
+            Dlog("lglw:loc_eventProc: xev ButtonPress\n");
+            XButtonPressedEvent *btnPress = (XButtonPressedEvent*)xev;
+            lglw->mouse.p.x = btnPress->x;
+            lglw->mouse.p.y = btnPress->y;
+            loc_kmod_sync(lglw, btnPress->state);
+
+            if(0u == (lglw->focus.state & LGLW_FOCUS_MOUSE))
+            {
+               loc_handle_mouseenter(lglw);
+            }
+
+            switch(btnPress->button)
+            {
+               default:
+                  Dlog("lglw:loc_eventProc: xev ButtonPress unhandled button: %i\n", btnPress->button);
+                  eventHandled = LGLW_FALSE;
+                  break;
+               case Button1:
+                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_LBUTTON);
+                  eventHandled = LGLW_TRUE;
+                  break;
+               case Button2:
+                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_MBUTTON);
+                  eventHandled = LGLW_TRUE;
+                  break;
+               case Button3:
+                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_RBUTTON);
+                  eventHandled = LGLW_TRUE;
+                  break;
+               case Button4:
+                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_WHEELUP);
+                  eventHandled = LGLW_TRUE;
+                  break;
+               case Button5:
+                  loc_handle_mousebutton(lglw, LGLW_TRUE/*bPressed*/, LGLW_MOUSE_WHEELDOWN);
+                  eventHandled = LGLW_TRUE;
+                  break;
+            }
+            break;
+
+         case ButtonRelease:
+            Dlog("lglw:loc_eventProc: xev ButtonRelease\n");
+            XButtonReleasedEvent *btnRelease = (XButtonReleasedEvent*)xev;
+            lglw->mouse.p.x = btnRelease->x;
+            lglw->mouse.p.y = btnRelease->y;
+            if(NULL != lglw->drag.provider.cbk)
+            {
+               loc_drag_handle_release(lglw, btnRelease->time);
+            }
+            switch(btnRelease->button)
+            {
+               default:
+                  Dlog("lglw:loc_eventProc: xev ButtonRelease unhandled button: %i\n", btnRelease->button);
+                  eventHandled = LGLW_FALSE;
+                  break;
+               case Button1:
+                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_LBUTTON);
+                  eventHandled = LGLW_TRUE;
+                  break;
+               case Button2:
+                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_MBUTTON);
+                  eventHandled = LGLW_TRUE;
+                  break;
+               case Button3:
+                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_RBUTTON);
+                  eventHandled = LGLW_TRUE;
+                  break;
+               case Button4:
+                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_WHEELUP);
+                  eventHandled = LGLW_TRUE;
+                  break;
+               case Button5:
+                  loc_handle_mousebutton(lglw, LGLW_FALSE/*bPressed*/, LGLW_MOUSE_WHEELDOWN);
+                  eventHandled = LGLW_TRUE;
+                  break;
+            }
+            break;
+
+         case SelectionNotify:
+            Dlog_v("lglw:loc_eventProc: xev SelectionNotify\n");
+            if(xev->xselection.selection == lglw->atoms[LGLW_ATOM_XDND_SELECTION])
+               loc_xdnd_handle_selection_notify(lglw, &xev->xselection);
+            else
+               loc_handle_selection_notify(lglw, &xev->xselection);
+            eventHandled = LGLW_TRUE;
+            break;
+
+         case ClientMessage:
+            eventHandled = loc_handle_client_message(lglw, &xev->xclient);
+            break;
+
+         case GenericEvent:
+            loc_handle_xi2_event(lglw, &xev->xcookie);
+            // (note) extension events can't be forwarded with XSendEvent()
+            eventHandled = LGLW_TRUE;
+            break;
+
+         case SelectionClear:
+            Dlog("lglw:loc_eventProc: xev SelectionClear\n");
+            // (note) ignore stale notifications that were sent before we re-acquired ownership
+            if(xev->xselectionclear.selection == lglw->atoms[LGLW_ATOM_CLIPBOARD])
+            {
+               if( (0 == lglw->clipboard.provider.owner_time) || (xev->xselectionclear.time >= lglw->clipboard.provider.owner_time) )
+               {
+                  loc_clipboard_provider_release(lglw);
+               }
+            }
+            else if(xev->xselectionclear.selection == lglw->atoms[LGLW_ATOM_XDND_SELECTION])
+            {
+               // Another client started a drag
+               if( (0 == lglw->drag.provider.owner_time) || (xev->xselectionclear.time >= lglw->drag.provider.owner_time) )
+               {
+                  lglw_drag_cancel(lglw);
+               }
+            }
+            eventHandled = LGLW_TRUE;
+            break;
+
+         case SelectionRequest:
+            Dlog("lglw:loc_eventProc: xev SelectionRequest\n");
+            loc_handle_selection_request(lglw, &xev->xselectionrequest);
+            eventHandled = LGLW_TRUE;
+            break;
+
+         case PropertyNotify:
+            loc_handle_property_notify(lglw, &xev->xproperty);
+            eventHandled = LGLW_TRUE;
+            break;
+      }
+
+      if(LGLW_FALSE == eventHandled)
+      {
+         if(0 == lglw->parent_xwnd)
+         {
+            Dlog("lglw:loc_eventProc: no parent window to send events to\n");
+            XSendEvent(lglw->xdsp, InputFocus, True/*propgate*/, NoEventMask, xev);
+         }
+         else
+         {
+            Dlog("lglw:loc_eventProc: sending event %i to parent\n", xev->type);
+            XSendEvent(lglw->xdsp, lglw->parent_xwnd, True/*propgate*/, NoEventMask, xev);
+         }
+      }
+   }
+}
+
+// ---------------------------------------------------------------------------- loc_event_time_update
+static void loc_event_time_update(lglw_int_t *lglw, XEvent *xev) {
+   switch(xev->type)
+   {
+      default:
+         lglw->event.server_time = 0u;  // event type has no timestamp
+         break;
+
+      case KeyPress:
+      case KeyRelease:
+         lglw->event.server_time = (uint32_t)xev->xkey.time;
+         break;
+
+      case ButtonPress:
+      case ButtonRelease:
+         lglw->event.server_time = (uint32_t)xev->xbutton.time;
+         break;
+
+      case MotionNotify:
+         lglw->event.server_time = (uint32_t)xev->xmotion.time;
+         break;
+
+      case EnterNotify:
+      case LeaveNotify:
+         lglw->event.server_time = (uint32_t)xev->xcrossing.time;
+         break;
+
+      case PropertyNotify:
+         lglw->event.server_time = (uint32_t)xev->xproperty.time;
+         break;
+
+      case SelectionClear:
+         lglw->event.server_time = (uint32_t)xev->xselectionclear.time;
+         break;
+
+      case SelectionRequest:
+         lglw->event.server_time = (uint32_t)xev->xselectionrequest.time;
+         break;
+
+      case SelectionNotify:
+         lglw->event.server_time = (uint32_t)xev->xselection.time;
+         break;
+   }
+}
+
+static void loc_XEventProc(void *_xevent) {
+   XEvent *xev = (XEvent*)_xevent;
+
+   Dlog_vvv("lglw:loc_XEventProc: ENTER\n");
+   // Dlog_vvv("lglw: XEventProc, xev=%p\n", xev);
+
+   if(NULL != xev)
+   {
+      // (note) GenericEvent has no window field
+      LGLW((GenericEvent == xev->type) ? loc_mouse_relative_owner : loc_window_map_find(xev->xany.window));
+
+      if(GenericEvent == xev->type)
+      {
+         if(NULL != lglw && lglw->xdsp == xev->xany.display)
+            loc_eventProc(xev, lglw);
+         return;
+      }
+
+      if(NULL == lglw)
+      {
+         // Window was not created by this module instance (e.g. another copy of the library that was loaded by the host)
+         lglw = loc_getProperty(xev->xany.display, xev->xany.window, loc_display_atom_get(xev->xany.display, LGLW_ATOM_LGLW));  // get instance pointer
+      }
+      Dlog_vvv("lglw:loc_XEventProc: xev=%p lglw=%p\n", xev, lglw);
+
+      loc_eventProc(xev, lglw);
+   }
+
+   Dlog_vvv("lglw:loc_XEventProc: LEAVE\n");
+}
+
+static void loc_setProperty(Display *_display, Window _window, Atom _atom, void *_value) {
+   size_t data = (size_t)_value;
+   long temp[2];
+
+   // Split the 64 bit pointer into a little-endian long array
+   temp[0] = (long)(data & 0xffffffffUL);
+   temp[1] = (long)(data >> 32L);
+
+   Dlog_v("lglw:loc_setProperty: atom=%lu value=%p temp[0]=%08x temp[1]=%08x\n", _atom, _value, (uint32_t)temp[0], (uint32_t)temp[1]);
+
+   // (note) what's quite weird here is that we're writing an array of 32bit values, yet the element format must be 64bit (long)
+   XChangeProperty(_display, _window,
+                   _atom/*property*/,
+                   _atom/*type*/,
+                   32/*format*/,
+                   PropModeReplace/*mode*/,
+                   (unsigned char*)temp/*data*/,
+                   2/*nelements*/
+                   );
+}
+
+static void *loc_getProperty(Display *_display, Window _window, Atom _atom) {
+   int userSize;
+   unsigned long bytes;
+   unsigned long userCount;
+   unsigned char *data;
+   Atom userType;
+
+   // (note) 64bit properties need to be read with two XGetWindowProperty() calls.
+   //         When using just one call and setting the 'length' to 2, the upper 32bit (second array element) will be 0xFFFFffff.
+   XGetWindowProperty(_display,
+                      _window,
+                      _atom,
+                      0/*offset*/,
+                      1/*length*/,
+                      False/*delete*/,
+                      AnyPropertyType,
+                      &userType/*actual_type_return*/,
+                      &userSize/*actual_format_return*/,
+                      &userCount/*nitems_return*/,
+                      &bytes/*bytes_after_return / partial reads*/,
+                      &data);
+
+   union {
+      uint32_t ui[2];
+      void *any;
+   } uptr;
+   uptr.any = 0;
+
+   Dlog_vvv("lglw:loc_getProperty: LOWER userSize=%d userCount=%lu bytes=%lu data=%p\n", userSize, userCount, bytes, data);
+
+   if(NULL != data)
+   {
+      if(userCount >= 1)
+      {
+         // lower 32-bit
+         uptr.ui[0] = *(long*)data;
+         uptr.ui[1] = 0;
+
+         Dlog_vvv("lglw:loc_getProperty:    lower=0x%08x\n", uptr.ui[0]);
+
+         XFree(data);
+
+         XGetWindowProperty(_display,
+                            _window,
+                            _atom,
+                            1/*offset*/,
+                            1/*length*/,
+                            False/*delete*/,
+                            AnyPropertyType,
+                            &userType/*actual_type_return*/,
+                            &userSize/*actual_format_return*/,
+                            &userCount/*nitems_return*/,
+                            &bytes/*bytes_after_return / partial reads*/,
+                            &data);
+
+         Dlog_vvv("lglw:loc_getProperty: UPPER userSize=%d userCount=%lu bytes=%lu data=%p\n", userSize, userCount, bytes, data);
+         if(NULL != data)
+         {
+            // upper 32-bit
+            uptr.ui[1] = *(long*)data;
+            Dlog_vvv("lglw:loc_getProperty:    upper=0x%08x\n", uptr.ui[1]);
+            XFree(data);
+         }
+      }
+   }
+
+   Dlog_vvv("lglw:loc_getProperty: return value=%p\n", uptr.any);
+
+   return uptr.any;
+}
+
+
+#ifdef ARCH_X64
+#if 0
+// Pulled from the Renoise 64-bit callback example
+// Unsure what data was supposed to be, but swapping it to a function name did not work
+// This does nothing, no event proc found
+static void loc_setEventProc (Display *display, Window window, Atom _atom) {
+   size_t data = (size_t)loc_eventProc;
+   long temp[2];
+
+   Dlog("lglw: setEventProc (2*32bit). window=%lu loc_eventProc=%p\n", window, &loc_eventProc);
+
+   // Split the 64 bit pointer into a little-endian unsigned int array
+   temp[0] = (uint32_t)(data & 0xffffffffUL);
+   temp[1] = (uint32_t)(data >> 32L);
+
+   XChangeProperty(display, window,
+                   _atom/*property*/,
+                   _atom/*type*/,
+                   32/*format*/,
+                   PropModeReplace/*mode*/,
+                   (unsigned char*)temp/*data*/,
+                   2/*nelements*/
+                   );
+}
+#else
+// GPL code pulled from the amsynth example <https://github.com/amsynth/amsynth/blob/4a87798e650c6d71d70274a961c9b8d98fc6da7e/src/amsynth_vst.cpp>
+// Simply swapped out the function names, crashes Ardour in the same was as the others
+static void loc_setEventProc (Display *display, Window window, Atom _atom) {
+   //
+   // JUCE calls XGetWindowProperty with long_length = 1 which means it only fetches the lower 32 bits of the address.
+   // Therefore we need to ensure we return an address in the lower 32-bits of address space.
+   //
+
+   // based on mach_override
+   static const unsigned char kJumpInstructions[] = {
+         0xFF, 0x25, 0x00, 0x00, 0x00, 0x00,
+         0x00, 0x00, 0x00, 0x00,
+         0x00, 0x00, 0x00, 0x00
+   };
+   static const int kJumpAddress = 6;
+
+   static char *ptr = 0;
+   if (!ptr) {
+      ptr = (char *)mmap(0,
+                         getpagesize()/*PAGE_SIZE*/,
+                         PROT_READ | PROT_WRITE | PROT_EXEC,
+                         MAP_ANONYMOUS | MAP_PRIVATE | MAP_32BIT,
+                         0, 0);
+      if (ptr == MAP_FAILED) {
+         perror("mmap");
+         ptr = 0;
+         return;
+      } else {
+         memcpy(ptr, kJumpInstructions, sizeof(kJumpInstructions));
+         *((uint64_t *)(ptr + kJumpAddress)) = (uint64_t)(&loc_XEventProc);
+         msync(ptr, sizeof(kJumpInstructions), MS_INVALIDATE);
+         Dlog("lglw: 64bit trampoline installed\n");
+      }
+   }
+
+   long temp[2] = {(uint32_t)(((size_t)ptr)&0xFFFFfffful), 0};
+   XChangeProperty(display, window,
+                   _atom/*property*/,
+                   _atom/*type*/,
+                   32/*format*/,
+                   PropModeReplace/*mode*/,
+                   (unsigned char *)temp/*data*/,
+                   2/*nelements*/
+                   );
+}
+#endif
+#else
+// Pulled from the eXT2 example
+static void loc_setEventProc (Display *display, Window window, Atom _atom) {
+   void* data = (void*)&loc_XEventProc; // swapped the function name here
+
+   // (note) 32-bit only
+   XChangeProperty(display, window,
+                   _atom/*property*/,
+                   _atom/*type*/,
+                   32/*format*/,
+                   PropModeReplace/*mode*/,
+                   (unsigned char*)&data/*data*/,
+                   1/*nelements*/
+                   );
+}
+#endif // ARCH_X64
+
+
+// ---------------------------------------------------------------------------- lglw_window_open
+lglw_bool_t lglw_window_open (lglw_t _lglw, void *_parentHWNDOrNull, int32_t _x, int32_t _y, int32_t _w, int32_t _h) {
+   lglw_bool_t r = LGLW_FALSE;
+   LGLW(_lglw);
+
+   if(NULL != lglw && loc_realize(lglw))
+   {
+      Dlog_v("lglw:lglw_window_open: 1, %p, %i p=(%d; %d) s=(%d; %d)\n", (Window)_parentHWNDOrNull, (Window)_parentHWNDOrNull, _x, _y, _w, _h);
+      lglw->parent_xwnd = (0 == _parentHWNDOrNull) ? DefaultRootWindow(lglw->xdsp) : (Window)_parentHWNDOrNull;
+
+      Dlog_v("lglw:lglw_window_open: 2 lglw=%p\n", lglw);
+      if(_w <= 16)
+         _w = lglw->hidden.size.x;
+
+      Dlog_v("lglw:lglw_window_open: 3\n");
+      if(_h <= 16)
+         _h = lglw->hidden.size.y;
+
+      // TODO: compare to 'WindowClass' from Windows implementation
+
+      Dlog_v("lglw:lglw_window_open: 4\n");
+      XSetWindowAttributes swa;
+      XSync(lglw->xdsp, False);
+
+      Dlog_v("lglw:lglw_window_open: 5\n");
+      swa.border_pixel = 0;
+      swa.colormap = lglw->cmap;
+      swa.event_mask = KeyPressMask | KeyReleaseMask | ButtonPressMask | ButtonReleaseMask | EnterWindowMask | LeaveWindowMask | PointerMotionMask | ButtonMotionMask | ExposureMask | FocusChangeMask | PropertyChangeMask/*INCR clipboard transfers*/; // NoEventMask to bubble-up to parent
+      lglw->win.xwnd = XCreateWindow(lglw->xdsp/*display*/,
+                                     DefaultRootWindow(lglw->xdsp)/*parent. see Cameron's comment below.*/,
+                                     0/*x*/,
+                                     0/*y*/,
+                                     _w/*width*/,
+                                     _h/*height*/,
+                                     0/*border_width*/,
+                                     CopyFromParent/*depth*/,
+                                     InputOutput/*class*/,
+                                     lglw->vi->visual,
+                                     CWBorderPixel | CWColormap | CWEventMask/*value_mask*/,
+                                     &swa/*attributes*/
+                                     );
+
+      Dlog_v("lglw:lglw_window_open: 6\n");
+      XSetStandardProperties(lglw->xdsp/*display*/,
+                             lglw->win.xwnd/*window*/,
+                             "LGLW"/*window_name*/,
+                             "LGLW"/*icon_name*/,
+                             None/*icon_pixmap*/,
+                             NULL/*argv*/,
+                             0/*argc*/,
+                             NULL/*XSizeHints*/
+                             );
+
+      Dlog_v("lglw:lglw_window_open: 7\n");
+
+#ifdef USE_XEVENTPROC
+      loc_setEventProc(lglw->xdsp, lglw->win.xwnd, lglw->atoms[LGLW_ATOM_XEVENTPROC]);
+#else
+      {
+         void *nowarn = &loc_setEventProc;
+         (void)nowarn;
+      }
+#endif
+
+      loc_setProperty(lglw->xdsp, lglw->win.xwnd, lglw->atoms[LGLW_ATOM_LGLW], (void*)lglw);  // set instance pointer
+      loc_window_map_add(lglw->win.xwnd, lglw);
+
+      if(0 != _parentHWNDOrNull)
+      {
+#ifdef USE_XEVENTPROC
+         loc_setEventProc(lglw->xdsp, lglw->parent_xwnd, lglw->atoms[LGLW_ATOM_XEVENTPROC]);
+#endif // USE_XEVENTPROC
+         loc_setProperty(lglw->xdsp, lglw->parent_xwnd, lglw->atoms[LGLW_ATOM_LGLW], (void*)lglw);  // set instance pointer
+         loc_window_map_add(lglw->parent_xwnd, lglw);
+      }
+
+      // Some hosts only check and store the callback when the Window is reparented
+      // Since creating the Window with a Parent may or may not do that, but the callback is not set,
+      // ... it's created as a root window, the callback is set, and then it's reparented
+      if (0 != _parentHWNDOrNull)
+      {
+         Dlog_v("lglw:lglw_window_open: 8\n");
+         XReparentWindow(lglw->xdsp, lglw->win.xwnd, lglw->parent_xwnd, 0, 0);
+      }
+
+      lglw->win.b_owner = LGLW_TRUE;
+
+      Dlog_v("lglw:lglw_window_open: 9\n");
+      if(lglw->win.b_owner)
+      {
+         // // XMapRaised(lglw->xdsp, lglw->win.xwnd);
+         XMapWindow(lglw->xdsp, lglw->win.xwnd);
+      }
+
+      XSync(lglw->xdsp, False);
+      lglw->win.mapped = LGLW_TRUE;
+
+      Dlog_v("lglw:lglw_window_open: 10\n");
+      lglw->win.size.x = _w;
+      lglw->win.size.y = _h;
+
+      Dlog_v("lglw:lglw_window_open: 11\n");
+      loc_enable_dropfiles(lglw, (NULL != lglw->dropfiles.cbk));
+
+      lglw->cursor.defined = None;
+      loc_cursor_update(lglw);
+
+      loc_frame_timer_start(lglw);  // resume frame callback (see lglw_window_close())
+
+      Dlog_v("lglw:lglw_window_open: EXIT\n");
+
+      r = LGLW_TRUE;
+   }
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_window_resize
+lglw_bool_t lglw_window_resize (lglw_t _lglw, int32_t _w, int32_t _h) {
+   lglw_bool_t r = LGLW_FALSE;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->hidden.xwnd)
+      {
+         XResizeWindow(lglw->xdsp, lglw->hidden.xwnd, _w, _h);
+
+#ifdef LGLW_CONTEXT_ALLOW_USE_AFTER_FREE
+         // (note) [bsp] destroying the GL context also destroys all GL objects attached to it
+         //               (_if_ the GL driver is implemented correctly).
+         //               IOW, if we destroy the context here, we'd have to re-create all the textures,
+         //               buffer objects, framebuffer objects, shaders, .. before they can be used again.
+         //               Apparently this works with certain GL drivers on Linux but it still is an application error.
+         loc_destroy_gl(lglw);
+         loc_create_gl(lglw);
+#endif // LGLW_CONTEXT_ALLOW_USE_AFTER_FREE
+      }
+
+      if(0 != lglw->win.xwnd)
+      {
+         r = LGLW_TRUE;
+
+         int deltaW = _w - lglw->win.size.x;
+         int deltaH = _h - lglw->win.size.y;
+
+         Dlog_v("Child Window Resize; old (%5i x %5i) new(%5i x %5i)\n", lglw->win.size.x, lglw->win.size.y, _w, _h);
+
+         lglw->win.size.x = _w;
+         lglw->win.size.y = _h;
+
+         Window root, parent, *children = NULL;
+         unsigned int num_children;
+
+         if(!XQueryTree(lglw->xdsp, lglw->win.xwnd, &root, &parent, &children, &num_children))
+            return r;
+
+         if(children)
+            XFree((char *)children);
+
+         // Resize parent window (if any)
+         if(0 != parent)
+         {
+            int x, y;
+            unsigned int width, height;
+            unsigned int border_width;
+            unsigned int depth;
+
+            if(!XGetGeometry(lglw->xdsp, lglw->win.xwnd, &root, &x, &y, &width, &height, &border_width, &depth))
+               return r;
+
+            Dlog_v("Parent Window Resize; old (%5i x %5i) new(%5i x %5i), delta (%5i x %5i)\n", width, height, width + deltaW, height + deltaH, deltaW, deltaH);
+
+            XResizeWindow(lglw->xdsp, parent, width + deltaW, height + deltaH);
+         }
+
+         XResizeWindow(lglw->xdsp, lglw->win.xwnd, _w, _h);
+         XRaiseWindow(lglw->xdsp, lglw->win.xwnd);
+      }
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_window_close
+void lglw_window_close (lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         Dlog_v("lglw:lglw_window_close: 1\n");
+         lglw_timer_stop(_lglw);
+         loc_frame_timer_stop(lglw);  // (note) the callback stays installed and resumes when the window is opened again
+         lglw_clipboard_request_cancel(_lglw);
+         loc_clipboard_provider_release(lglw);
+         lglw_drag_cancel(_lglw);
+         lglw_mouse_ungrab(_lglw);
+
+         Dlog_v("lglw:lglw_window_close: 2\n");
+         glXMakeCurrent(lglw->gl_xdsp, None, NULL);
+
+         Dlog_v("lglw:lglw_window_close: 3\n");
+         loc_window_map_remove(lglw->win.xwnd, lglw);
+         loc_window_map_remove(lglw->parent_xwnd, lglw);  // (note) no-op when there is no host parent window
+
+         if(lglw->win.b_owner)
+         {
+            XUnmapWindow(lglw->xdsp, lglw->win.xwnd);
+            XDestroyWindow(lglw->xdsp, lglw->win.xwnd);
+            lglw->win.b_owner = LGLW_FALSE;
+         }
+         XSync(lglw->xdsp, False);
+         lglw->win.xwnd = 0;
+         lglw->win.mapped = LGLW_FALSE;
+         lglw->cursor.defined = None;
+
+         // (note) events on a shared connection may belong to other instances. events for the
+         //         destroyed window will be discarded by loc_events_dispatch().
+         if(!lglw->b_shared_xdsp)
+         {
+            XEvent xev;
+            int queued = XPending(lglw->xdsp);
+            Dlog_vvv("lglw:lglw_window_close: consume %d pending events\n", queued);
+            while(queued)
+            {
+               XNextEvent(lglw->xdsp, &xev);
+               queued--;
+            }
+         }
+      }
+   }
+   Dlog_v("lglw:lglw_window_close: EXIT\n");
+}
+
+
+// ---------------------------------------------------------------------------- lglw_window_show
+void lglw_window_show(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      Dlog_v("lglw:lglw_window_show: 1\n");
+      XMapRaised(lglw->xdsp, lglw->win.xwnd);
+
+      lglw->win.mapped = LGLW_TRUE;
+   }
+   Dlog_v("lglw:lglw_window_show: EXIT\n");
+}
+
+
+// ---------------------------------------------------------------------------- lglw_window_hide
+void lglw_window_hide(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      Dlog_v("lglw:lglw_window_hide: 1\n");
+      XUnmapWindow(lglw->xdsp, lglw->win.xwnd);
+
+      lglw->win.mapped = LGLW_FALSE;
+   }
+   Dlog_v("lglw:lglw_window_hide: EXIT\n");
+}
+
+
+// ---------------------------------------------------------------------------- lglw_window_is_visible
+lglw_bool_t lglw_window_is_visible(lglw_t _lglw) {
+   lglw_bool_t r = LGLW_FALSE;
+   LGLW(_lglw);
+
+   // Dlog_vvv("lglw:lglw_window_is_visible: 1\n");
+   if(NULL != lglw && 0 != lglw->win.xwnd)
+   {
+      // Dlog_vvv("lglw:lglw_window_is_visible: 2\n");
+      r = lglw->win.mapped;
+   }
+
+   // Dlog_vvv("lglw:lglw_window_is_visible: EXIT\n");
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_window_size_get
+void lglw_window_size_get(lglw_t _lglw, int32_t *_retX, int32_t *_retY) {
+   LGLW(_lglw);
+
+   Dlog_vvv("lglw:lglw_window_size_get: 1\n");
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         if(NULL != _retX)
+            *_retX = lglw->win.size.x;
+
+         if(NULL != _retY)
+            *_retY = lglw->win.size.y;
+      }
+   }
+   Dlog_vvv("lglw:lglw_window_size_get: EXIT\n");
+}
+
+
+// ---------------------------------------------------------------------------- lglw_redraw
+void lglw_redraw(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         Dlog_vvv("lglw:lglw_redraw: 1\n");
+         XEvent xev;
+         xev.xany.type       = Expose;
+         xev.xany.serial     = 0;
+         xev.xany.send_event = True;
+         xev.xany.display    = lglw->xdsp;
+         xev.xany.window     = lglw->win.xwnd;
+         xev.xexpose.x      = 0;
+         xev.xexpose.y      = 0;
+         xev.xexpose.width  = lglw->win.size.x;
+         xev.xexpose.height = lglw->win.size.y;
+         xev.xexpose.count  = 0;
+         XSendEvent(lglw->xdsp, lglw->win.xwnd,
+                    True/*propagate*/,
+                    ExposureMask/*event_mask*/,
+                    &xev
+                    );
+         XFlush(lglw->xdsp);
+
+         // Wake up the event loop right away (this may be called from another thread)
+         loc_event_wakeup(lglw);
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_redraw_callback_set
+void lglw_redraw_callback_set(lglw_t _lglw, lglw_redraw_fxn_t _cbk) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->redraw.cbk = _cbk;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_push
+void lglw_glcontext_push(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw_bool_t bRealized = loc_realize(lglw);
+      GLXDrawable drw = (0 == lglw->win.xwnd) ? lglw->hidden.xwnd : lglw->win.xwnd;
+      lglw_glcontext_stack_entry_t *prev = NULL;
+
+      if(loc_glcontext_stack.depth < LGLW_GLCONTEXT_STACK_SIZE)
+      {
+         prev = &loc_glcontext_stack.entries[loc_glcontext_stack.depth];
+      }
+      else
+      {
+         Dlog("[---] lglw_glcontext_push: stack overflow (max depth=%u)\n", LGLW_GLCONTEXT_STACK_SIZE);
+      }
+      loc_glcontext_stack.depth++;  // (note) also counts overflowing pushes so that pop() stays balanced
+
+      // (note) these are client-side queries (no server round trip)
+      GLXContext  curCtx = glXGetCurrentContext();
+      GLXDrawable curDrw = glXGetCurrentDrawable();
+
+      if(NULL != prev)
+      {
+         prev->xdsp    = glXGetCurrentDisplay();
+         prev->drw     = curDrw;
+         prev->ctx     = curCtx;
+         prev->b_bound = LGLW_FALSE;
+      }
+
+      Dlog_vvv("lglw:lglw_glcontext_push: win.xwnd=%p hidden.xwnd=%p ctx=%p depth=%u\n",
+               lglw->win.xwnd, lglw->hidden.xwnd, lglw->ctx, loc_glcontext_stack.depth);
+
+      if(!bRealized)
+      {
+         Dlog("[---] lglw_glcontext_push: failed to create GL context\n");
+      }
+      else if( (curCtx == lglw->ctx) && (curDrw == drw) )
+      {
+         // Already bound (e.g. nested push, or previous pop() skipped the restore)
+         lglw->glctx_stats.num_binds_skipped++;
+      }
+      else
+      {
+         lglw->glctx_stats.num_binds++;
+
+         if(!glXMakeCurrent(lglw->gl_xdsp, drw, lglw->ctx))
+         {
+            Dlog("[---] lglw_glcontext_push: glXMakeCurrent() failed. win.xwnd=%p hidden.xwnd=%p ctx=%p glGetError()=%d\n", lglw->win.xwnd, lglw->hidden.xwnd, lglw->ctx, glGetError());
+         }
+         else if(NULL != prev)
+         {
+            prev->b_bound = LGLW_TRUE;
+         }
+      }
+      // Dlog_vvv("lglw:lglw_glcontext_push: LEAVE\n");
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_rebind
+void lglw_glcontext_rebind(lglw_t _lglw) {
+   LGLW(_lglw);
+   // printf("xxx lglw_glcontext_rebind\n");
+
+   if(NULL != lglw && loc_realize(lglw))
+   {
+      Dlog_vvv("lglw:lglw_glcontext_rebind: win.xwnd=%p hidden.xwnd=%p ctx=%p\n",
+               lglw->win.xwnd, lglw->hidden.xwnd, lglw->ctx);
+      (void)glXMakeCurrent(lglw->gl_xdsp, None, NULL);
+      if(!glXMakeCurrent(lglw->gl_xdsp, (0 == lglw->win.xwnd) ? lglw->hidden.xwnd : lglw->win.xwnd, lglw->ctx))
+      {
+         Dlog("[---] lglw_glcontext_rebind: glXMakeCurrent() failed. win.xwnd=%p hidden.xwnd=%p ctx=%p glGetError()=%d\n", lglw->win.xwnd, lglw->hidden.xwnd, lglw->ctx, glGetError());
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_pop
+void lglw_glcontext_pop(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(loc_glcontext_stack.depth > 0u)
+      {
+         loc_glcontext_stack.depth--;
+
+         if(loc_glcontext_stack.depth < LGLW_GLCONTEXT_STACK_SIZE)
+         {
+            lglw_glcontext_stack_entry_t *prev = &loc_glcontext_stack.entries[loc_glcontext_stack.depth];
+
+            Dlog_vvv("lglw:lglw_glcontext_pop: prev.drw=%p prev.ctx=%p b_bound=%d depth=%u\n",
+                     prev->drw, prev->ctx, prev->b_bound, loc_glcontext_stack.depth);
+
+            if(prev->b_bound)
+            {
+               lglw->glctx_stats.num_binds++;
+
+               if(!glXMakeCurrent((NULL != prev->xdsp) ? prev->xdsp : lglw->gl_xdsp, prev->drw, prev->ctx))
+               {
+                  Dlog("[---] lglw_glcontext_pop: glXMakeCurrent() failed. prev.drw=%p ctx=%p glGetError()=%d\n", prev->drw, prev->ctx, glGetError());
+               }
+            }
+            else
+            {
+               // push() did not change the binding, nothing to restore
+               lglw->glctx_stats.num_binds_skipped++;
+            }
+         }
+      }
+      else
+      {
+         Dlog("[---] lglw_glcontext_pop: stack underflow\n");
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_stats_get
+void lglw_glcontext_stats_get(lglw_t _lglw, uint32_t *_retNumBinds, uint32_t *_retNumBindsSkipped) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(NULL != _retNumBinds)
+         *_retNumBinds = lglw->glctx_stats.num_binds;
+
+      if(NULL != _retNumBindsSkipped)
+         *_retNumBindsSkipped = lglw->glctx_stats.num_binds_skipped;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_worker_create
+lglw_glworker_t lglw_glcontext_worker_create(lglw_t _lglw) {
+   lglw_glworker_int_t *worker = NULL;
+   LGLW(_lglw);
+
+   if(NULL != lglw && loc_realize(lglw))
+   {
+      worker = malloc(sizeof(lglw_glworker_int_t));
+
+      if(NULL != worker)
+      {
+         XSetWindowAttributes swa;
+
+         memset(worker, 0, sizeof(lglw_glworker_int_t));
+         worker->lglw = lglw;
+
+         // (note) the worker context must be created on the connection of the context it shares objects with
+         //         (see loc_create_gl()). the window uses the cached colormap, and since all requests are sent on
+         //         the same connection, they are processed in order (no XSync() needed).
+         worker->xdsp = lglw->gl_xdsp;
+
+         swa.border_pixel = 0;
+         swa.colormap = lglw->cmap;
+         worker->xwnd = XCreateWindow(worker->xdsp, RootWindow(worker->xdsp, lglw->vi->screen),
+                                      0, 0, 1, 1, 0, lglw->vi->depth, InputOutput,
+                                      lglw->vi->visual, CWBorderPixel | CWColormap, &swa);
+
+         worker->ctx = glXCreateContext(worker->xdsp, lglw->vi, lglw->ctx, True/*direct*/);
+
+         XFlush(worker->xdsp);
+
+         if(NULL == worker->ctx)
+         {
+            Dlog("[---] lglw:lglw_glcontext_worker_create: failed to create shared context\n");
+            lglw_glcontext_worker_destroy(worker);
+            worker = NULL;
+         }
+         else
+         {
+            Dlog_v("lglw:lglw_glcontext_worker_create: worker=%p ctx=%p share=%p\n", worker, worker->ctx, lglw->ctx);
+            loc_glsync_init();
+         }
+      }
+   }
+
+   return worker;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_worker_destroy
+void lglw_glcontext_worker_destroy(lglw_glworker_t _worker) {
+   lglw_glworker_int_t *worker = (lglw_glworker_int_t*)_worker;
+
+   if(NULL != worker)
+   {
+      if(NULL != worker->xdsp)
+      {
+         if(NULL != worker->ctx)
+         {
+            if(glXGetCurrentContext() == worker->ctx)
+               glXMakeCurrent(worker->xdsp, None, NULL);
+
+            glXDestroyContext(worker->xdsp, worker->ctx);
+         }
+
+         if(0 != worker->xwnd)
+            XDestroyWindow(worker->xdsp, worker->xwnd);
+
+         // (note) connection is owned by the instance
+         XFlush(worker->xdsp);
+      }
+
+      free(worker);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_worker_bind
+lglw_bool_t lglw_glcontext_worker_bind(lglw_glworker_t _worker) {
+   lglw_bool_t r = LGLW_FALSE;
+   lglw_glworker_int_t *worker = (lglw_glworker_int_t*)_worker;
+
+   if(NULL != worker)
+   {
+      r = glXMakeCurrent(worker->xdsp, worker->xwnd, worker->ctx) ? LGLW_TRUE : LGLW_FALSE;
+
+      if(!r)
+      {
+         Dlog("[---] lglw_glcontext_worker_bind: glXMakeCurrent() failed. worker=%p ctx=%p\n", worker, worker->ctx);
+      }
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_worker_unbind
+void lglw_glcontext_worker_unbind(lglw_glworker_t _worker) {
+   lglw_glworker_int_t *worker = (lglw_glworker_int_t*)_worker;
+
+   if(NULL != worker)
+   {
+      glXMakeCurrent(worker->xdsp, None, NULL);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_glsync_init_once
+static void loc_glsync_init_once(void) {
+   loc_glsync.FenceSync      = (PFNGLFENCESYNCPROC)      glXGetProcAddress((const GLubyte*)"glFenceSync");
+   loc_glsync.ClientWaitSync = (PFNGLCLIENTWAITSYNCPROC) glXGetProcAddress((const GLubyte*)"glClientWaitSync");
+   loc_glsync.WaitSync       = (PFNGLWAITSYNCPROC)       glXGetProcAddress((const GLubyte*)"glWaitSync");
+   loc_glsync.DeleteSync     = (PFNGLDELETESYNCPROC)     glXGetProcAddress((const GLubyte*)"glDeleteSync");
+}
+
+
+// ---------------------------------------------------------------------------- loc_glsync_init
+static void loc_glsync_init(void) {
+   pthread_once(&loc_glsync.once, &loc_glsync_init_once);
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glfence_insert
+lglw_glfence_t lglw_glfence_insert(void) {
+   GLsync r = NULL;
+
+   loc_glsync_init();
+
+   if(NULL != loc_glsync.FenceSync)
+   {
+      r = loc_glsync.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+      // Make sure the fence (and the commands preceding it) reach the GPU even if the other thread waits on it first
+      glFlush();
+   }
+
+   return (lglw_glfence_t)r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glfence_wait
+lglw_bool_t lglw_glfence_wait(lglw_glfence_t _fence, uint64_t _timeoutNS) {
+   lglw_bool_t r = LGLW_FALSE;
+
+   if(NULL != _fence && NULL != loc_glsync.ClientWaitSync)
+   {
+      GLenum res = loc_glsync.ClientWaitSync((GLsync)_fence, GL_SYNC_FLUSH_COMMANDS_BIT, (GLuint64)_timeoutNS);
+      r = (GL_ALREADY_SIGNALED == res) || (GL_CONDITION_SATISFIED == res);
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glfence_wait_gpu
+void lglw_glfence_wait_gpu(lglw_glfence_t _fence) {
+   if(NULL != _fence && NULL != loc_glsync.WaitSync)
+   {
+      loc_glsync.WaitSync((GLsync)_fence, 0, GL_TIMEOUT_IGNORED);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glfence_delete
+void lglw_glfence_delete(lglw_glfence_t _fence) {
+   if(NULL != _fence && NULL != loc_glsync.DeleteSync)
+   {
+      loc_glsync.DeleteSync((GLsync)_fence);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_swap_buffers
+void lglw_swap_buffers(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         Dlog_vvv("lglw:lglw_swap_buffers: 1\n");
+         glXSwapBuffers(lglw->gl_xdsp, lglw->win.xwnd);
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_glx_has_extension
+static lglw_bool_t loc_glx_has_extension(lglw_int_t *lglw, const char *_name) {
+   const char *exts;
+
+   if(NULL == lglw->xdsp || NULL == lglw->vi)
+      return LGLW_FALSE;  // not realized, yet (LGLW_INIT_LAZY)
+
+   exts = glXQueryExtensionsString(lglw->xdsp, lglw->vi->screen);
+
+   if(NULL != exts)
+   {
+      size_t nameLen = strlen(_name);
+      const char *c = exts;
+
+      while(NULL != (c = strstr(c, _name)))
+      {
+         // Match whole (space separated) tokens only
+         if( ((c == exts) || (' ' == c[-1])) && ((' ' == c[nameLen]) || (0 == c[nameLen])) )
+            return LGLW_TRUE;
+
+         c += nameLen;
+      }
+   }
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- loc_frame_sync
+//  Determine display refresh period and the time of a recent refresh (vblank)
+static void loc_frame_sync(lglw_int_t *lglw) {
+   GLXDrawable drw = (0 != lglw->win.xwnd) ? lglw->win.xwnd : lglw->hidden.xwnd;
+
+   if(lglw->frame.b_oml)
+   {
+      PFNGLXGETMSCRATEOMLPROC    glXGetMscRateOML    = (PFNGLXGETMSCRATEOMLPROC)    glXGetProcAddress((const GLubyte*)"glXGetMscRateOML");
+      PFNGLXGETSYNCVALUESOMLPROC glXGetSyncValuesOML = (PFNGLXGETSYNCVALUESOMLPROC) glXGetProcAddress((const GLubyte*)"glXGetSyncValuesOML");
+      int32_t num, den;
+      int64_t ust, msc, sbc;
+
+      if( (NULL != glXGetMscRateOML) && glXGetMscRateOML(lglw->gl_xdsp, drw, &num, &den) && (num > 0) && (den > 0) )
+      {
+         lglw->frame.period_ns = ((uint64_t)den * 1000000000u) / (uint64_t)num;
+      }
+
+      // (note) UST is CLOCK_MONOTONIC in microseconds on Linux (DRM)
+      if( (NULL != glXGetSyncValuesOML) && glXGetSyncValuesOML(lglw->gl_xdsp, drw, &ust, &msc, &sbc) && (ust > 0) )
+      {
+         lglw->frame.phase_ns = (uint64_t)ust * 1000u;
+      }
+
+      Dlog_v("lglw:loc_frame_sync: OML period=%lluns phase=%lluns\n", (unsigned long long)lglw->frame.period_ns, (unsigned long long)lglw->frame.phase_ns);
+   }
+   else if(NULL != lglw->xdsp)
+   {
+      uint64_t periodNS = loc_randr_refresh_period_ns(lglw);
+
+      if(periodNS > 0u)
+         lglw->frame.period_ns = periodNS;
+
+      Dlog_v("lglw:loc_frame_sync: RandR period=%lluns\n", (unsigned long long)lglw->frame.period_ns);
+   }
+
+   lglw->frame.resync_count = LGLW_FRAME_RESYNC_INTERVAL;
+}
+
+
+// ---------------------------------------------------------------------------- loc_randr_refresh_period_ns
+//  Query the refresh period of the CRTC that shows the window center (or of the first active CRTC) via RandR >= 1.3
+//   Return: period (nanoseconds) or 0 when the refresh rate cannot be determined
+static uint64_t loc_randr_refresh_period_ns(lglw_int_t *lglw) {
+   Display *dpy = lglw->xdsp;
+   Window root = RootWindow(dpy, lglw->vi->screen);
+   XRRScreenResources *res;
+   int cx = -1;
+   int cy = -1;
+   RRMode mode = None;
+   int i;
+   uint64_t r = 0u;
+
+   if(0 == lglw->frame.randr_status)
+   {
+      int event, error;
+      int major = 0, minor = 0;
+
+      lglw->frame.randr_status = -1;
+
+      if(XRRQueryExtension(dpy, &event, &error) && XRRQueryVersion(dpy, &major, &minor))
+      {
+         if( (major > 1) || ((1 == major) && (minor >= 3)) )
+            lglw->frame.randr_status = 1;
+      }
+
+      Dlog_v("lglw:loc_randr_refresh_period_ns: RandR version=%d.%d status=%d\n", major, minor, lglw->frame.randr_status);
+   }
+
+   if(lglw->frame.randr_status <= 0)
+      return 0u;
+
+   if(0 != lglw->win.xwnd)
+   {
+      Window child;
+
+      if(!XTranslateCoordinates(dpy, lglw->win.xwnd, root, lglw->win.size.x / 2, lglw->win.size.y / 2, &cx, &cy, &child))
+      {
+         cx = -1;
+         cy = -1;
+      }
+   }
+
+   // CRTCs, outputs and modes of the screen
+   //  (note) XRRGetScreenResourcesCurrent() does not poll the outputs (fast)
+   res = XRRGetScreenResourcesCurrent(dpy, root);
+
+   if(NULL == res)
+      return 0u;
+
+   // Find the CRTC that contains the window center
+   for(i = 0; i < res->ncrtc; i++)
+   {
+      XRRCrtcInfo *crtc = XRRGetCrtcInfo(dpy, res, res->crtcs[i]);
+
+      if(NULL != crtc)
+      {
+         lglw_bool_t bFound = LGLW_FALSE;
+
+         if(None != crtc->mode)
+         {
+            if( (cx < 0) ||
+                ( (cx >= crtc->x) && (cx < (crtc->x + (int)crtc->width)) && (cy >= crtc->y) && (cy < (crtc->y + (int)crtc->height)) )
+                )
+            {
+               mode = crtc->mode;
+               bFound = LGLW_TRUE;
+            }
+            else if(None == mode)
+            {
+               mode = crtc->mode;  // window center is off-screen: use the first active CRTC
+            }
+         }
+
+         XRRFreeCrtcInfo(crtc);
+
+         if(bFound)
+            break;
+      }
+   }
+
+   // Refresh rate = dot clock / (htotal * vtotal)
+   for(i = 0; (None != mode) && (i < res->nmode); i++)
+   {
+      const XRRModeInfo *mi = &res->modes[i];
+
+      if(mi->id == mode)
+      {
+         uint64_t vTotal = mi->vTotal;
+
+         if(0u != (mi->modeFlags & RR_DoubleScan))
+            vTotal *= 2u;
+
+         if(0u != (mi->modeFlags & RR_Interlace))
+            vTotal /= 2u;
+
+         if( (mi->dotClock > 0u) && (mi->hTotal > 0u) && (vTotal > 0u) )
+         {
+            r = ((uint64_t)mi->hTotal * vTotal * 1000000000u) / mi->dotClock;
+
+            // Ignore bogus modes (e.g. virtual outputs that report a 0Hz / 1000Hz+ refresh rate)
+            if( (r < 1000000u) || (r > 100000000u) )
+               r = 0u;
+         }
+
+         Dlog_v("lglw:loc_randr_refresh_period_ns: mode=0x%lx %ux%u dotClock=%lu total=(%u; %u) period=%lluns\n",
+                (unsigned long)mode, mi->width, mi->height, (unsigned long)mi->dotClock, mi->hTotal, mi->vTotal, (unsigned long long)r);
+         break;
+      }
+   }
+
+   XRRFreeScreenResources(res);
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- loc_frame_timer_cbk
+static void loc_frame_timer_cbk(lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData) {
+   LGLW(_lglw);
+   (void)_numMissed;
+   (void)_userData;
+
+   if(NULL != lglw->frame.cbk)
+   {
+      uint64_t ns;
+
+      // (note) RandR fallback: phase stays the same, the timer is only realigned when the refresh period changes
+      //         (e.g. when the window is moved to another monitor)
+      if(0u == --lglw->frame.resync_count)
+      {
+         uint64_t oldPhaseNS = lglw->frame.phase_ns;
+         uint64_t oldPeriodNS = lglw->frame.period_ns;
+
+         loc_frame_sync(lglw);
+
+         // (note) sampled after the resync so that a vblank that happened during loc_frame_sync() is not in the future
+         ns = loc_time_ns();
+
+         if(lglw->frame.phase_ns > ns)
+            lglw->frame.phase_ns = ns;  // (note) should not happen (UST in the future ?!)
+
+         // Realign timer when the refresh clock has drifted away from our tick grid
+         //  (note) signed difference (the phase may move backwards)
+         int64_t driftNS = ((int64_t)lglw->frame.phase_ns - (int64_t)oldPhaseNS) % (int64_t)oldPeriodNS;
+         if(driftNS < 0)
+            driftNS = -driftNS;
+         if(driftNS > (int64_t)(oldPeriodNS >> 1))
+            driftNS = (int64_t)oldPeriodNS - driftNS;
+
+         if( (oldPeriodNS != lglw->frame.period_ns) || (driftNS > (int64_t)(oldPeriodNS >> 3)) )
+         {
+            Dlog_v("lglw:loc_frame_timer_cbk: realign timer (drift=%lldns)\n", (long long)driftNS);
+            lglw_timer_remove(lglw, _timerId);
+            lglw->frame.timer_id = loc_timer_add(lglw,
+                                                 lglw->frame.phase_ns + (((ns - lglw->frame.phase_ns) / lglw->frame.period_ns) + 1u) * lglw->frame.period_ns,
+                                                 lglw->frame.period_ns,
+                                                 &loc_frame_timer_cbk, NULL/*userData*/
+                                                 );
+         }
+      }
+      else
+      {
+         ns = loc_time_ns();
+      }
+
+      // Next refresh after 'now' is when the frame rendered by the callback will be presented
+      uint64_t presentNS = lglw->frame.phase_ns + (((ns - lglw->frame.phase_ns) / lglw->frame.period_ns) + 1u) * lglw->frame.period_ns;
+
+      Dlog_vvv("lglw:loc_frame_timer_cbk: presentNS=%llu\n", (unsigned long long)presentNS);
+      lglw->frame.cbk(lglw, presentNS);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_frame_timer_start
+//  Start ticking right after each refresh (see lglw_frame_callback_set())
+//   (note) only while the window is open (see lglw_window_open() / lglw_window_close())
+static void loc_frame_timer_start(lglw_int_t *lglw) {
+
+   if( (NULL != lglw->frame.cbk) && (0u == lglw->frame.timer_id) && (0 != lglw->win.xwnd) )
+   {
+      uint64_t ns = loc_time_ns();
+
+      lglw->frame.period_ns = LGLW_FRAME_DEFAULT_PERIOD_NS;
+      lglw->frame.phase_ns  = ns;
+      lglw->frame.b_oml     = loc_glx_has_extension(lglw, "GLX_OML_sync_control");
+
+      loc_frame_sync(lglw);
+
+      if(lglw->frame.phase_ns > ns)
+         lglw->frame.phase_ns = ns;  // (note) should not happen (UST in the future ?!)
+
+      lglw->frame.timer_id = loc_timer_add(lglw,
+                                           lglw->frame.phase_ns + (((ns - lglw->frame.phase_ns) / lglw->frame.period_ns) + 1u) * lglw->frame.period_ns,
+                                           lglw->frame.period_ns,
+                                           &loc_frame_timer_cbk, NULL/*userData*/
+                                           );
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_frame_timer_stop
+static void loc_frame_timer_stop(lglw_int_t *lglw) {
+
+   if(0u != lglw->frame.timer_id)
+   {
+      lglw_timer_remove(lglw, lglw->frame.timer_id);
+      lglw->frame.timer_id = 0u;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_frame_callback_set
+void lglw_frame_callback_set(lglw_t _lglw, lglw_frame_fxn_t _cbk) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      loc_frame_timer_stop(lglw);
+
+      lglw->frame.cbk = _cbk;
+
+      loc_frame_timer_start(lglw);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_frame_period_get
+uint64_t lglw_frame_period_get(lglw_t _lglw) {
+   uint64_t r = 0u;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      r = (0u != lglw->frame.period_ns) ? lglw->frame.period_ns : LGLW_FRAME_DEFAULT_PERIOD_NS;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_swap_interval_set
+typedef void (APIENTRY *PFNWGLEXTSWAPINTERVALPROC) (Display *, GLXDrawable, int);
+void lglw_swap_interval_set(lglw_t _lglw, int32_t _ival) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         Dlog_vv("lglw:lglw_swap_interval_set: 1\n");
+         PFNWGLEXTSWAPINTERVALPROC glXSwapIntervalEXT;
+         glXSwapIntervalEXT = (PFNWGLEXTSWAPINTERVALPROC) glXGetProcAddress((const GLubyte*)"glXSwapIntervalEXT");
+         if(NULL != glXSwapIntervalEXT)
+         {
+            Dlog_vv("lglw:lglw_swap_interval_set: 2\n");
+            glXSwapIntervalEXT(lglw->gl_xdsp, lglw->win.xwnd, _ival);
+            lglw->win.swap_interval = _ival;
+         }
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_swap_interval_get
+int32_t lglw_swap_interval_get(lglw_t _lglw) {
+   LGLW(_lglw);
+   int32_t r = 0;
+
+   if(NULL != lglw)
+   {
+      r = lglw->win.swap_interval;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_mouseleave
+static void loc_handle_mouseleave(lglw_int_t *lglw) {
+   lglw->focus.state &= ~LGLW_FOCUS_MOUSE;
+
+   if(lglw->queue.b_enable)
+   {
+      lglw_event_t *ev = loc_event_queue_alloc(lglw, LGLW_EVENT_FOCUS);
+      if(NULL != ev)
+      {
+         ev->u.focus.focus_state         = lglw->focus.state;
+         ev->u.focus.changed_focus_state = LGLW_FOCUS_MOUSE;
+      }
+   }
+   else if(NULL != lglw->focus.cbk)
+   {
+      lglw->focus.cbk(lglw, lglw->focus.state, LGLW_FOCUS_MOUSE);
+   }
+
+   Dlog_vv("xxx lglw:loc_handle_mouseleave: LEAVE\n");
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_mouseenter
+static void loc_handle_mouseenter(lglw_int_t *lglw) {
+
+   lglw->focus.state |= LGLW_FOCUS_MOUSE;
+
+   if(lglw->queue.b_enable)
+   {
+      lglw_event_t *ev = loc_event_queue_alloc(lglw, LGLW_EVENT_FOCUS);
+      if(NULL != ev)
+      {
+         ev->u.focus.focus_state         = lglw->focus.state;
+         ev->u.focus.changed_focus_state = LGLW_FOCUS_MOUSE;
+      }
+   }
+   else if(NULL != lglw->focus.cbk)
+   {
+      lglw->focus.cbk(lglw, lglw->focus.state, LGLW_FOCUS_MOUSE);
+   }
+
+   Dlog_vv("xxx lglw:loc_handle_mouseenter: LEAVE\n");
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_mousebutton
+static void loc_handle_mousebutton(lglw_int_t *lglw, lglw_bool_t _bPressed, uint32_t _button) {
+   if(_bPressed)
+      lglw->mouse.button_state |= _button;
+   else
+      lglw->mouse.button_state &= ~_button;
+
+   if(lglw->queue.b_enable)
+   {
+      lglw_event_t *ev = loc_event_queue_alloc(lglw, LGLW_EVENT_MOUSE);
+      if(NULL != ev)
+      {
+         ev->u.mouse.x                    = lglw->mouse.p.x;
+         ev->u.mouse.y                    = lglw->mouse.p.y;
+         ev->u.mouse.button_state         = lglw->mouse.button_state;
+         ev->u.mouse.changed_button_state = _button;
+         ev->u.mouse.num_merged           = 0u;
+      }
+   }
+   else if(NULL != lglw->mouse.cbk)
+   {
+      lglw->mouse.cbk(lglw, lglw->mouse.p.x, lglw->mouse.p.y, lglw->mouse.button_state, _button);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_mousemotion
+static void loc_handle_mousemotion(lglw_int_t *lglw) {
+
+   if(lglw->queue.b_enable)
+   {
+      lglw_event_t *ev = loc_event_queue_alloc(lglw, LGLW_EVENT_MOUSE);
+      if(NULL != ev)
+      {
+         ev->u.mouse.x                    = lglw->mouse.p.x;
+         ev->u.mouse.y                    = lglw->mouse.p.y;
+         ev->u.mouse.button_state         = lglw->mouse.button_state;
+         ev->u.mouse.changed_button_state = 0u;
+         ev->u.mouse.num_merged           = lglw->mouse.motion.num_merged;
+      }
+   }
+   else if(NULL != lglw->mouse.cbk)
+   {
+      lglw->mouse.cbk(lglw, lglw->mouse.p.x, lglw->mouse.p.y, lglw->mouse.button_state, 0u/*changedbuttonstate*/);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_xmotion
+static void loc_handle_xmotion(lglw_int_t *lglw, XMotionEvent *_motion) {
+
+   if(LGLW_MOUSE_GRAB_WARP == lglw->mouse.grab.mode)
+   {
+      lglw->mouse.grab.b_queue_warp = LGLW_TRUE;
+
+      lglw->mouse.p.x += (_motion->x - lglw->mouse.grab.last_p.x);
+      lglw->mouse.p.y += (_motion->y - lglw->mouse.grab.last_p.y);
+
+      lglw->mouse.grab.last_p.x = _motion->x;
+      lglw->mouse.grab.last_p.y = _motion->y;
+   }
+   else
+   {
+      lglw->mouse.p.x = _motion->x;
+      lglw->mouse.p.y = _motion->y;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_mouse_relative
+static void loc_handle_mouse_relative(lglw_int_t *lglw, float _dx, float _dy) {
+
+   if(lglw->queue.b_enable)
+   {
+      lglw_event_t *ev = loc_event_queue_alloc(lglw, LGLW_EVENT_MOUSE_RELATIVE);
+      if(NULL != ev)
+      {
+         ev->u.mouse_relative.dx           = _dx;
+         ev->u.mouse_relative.dy           = _dy;
+         ev->u.mouse_relative.button_state = lglw->mouse.button_state;
+      }
+   }
+   else if(NULL != lglw->mouse.relative.cbk)
+   {
+      lglw->mouse.relative.cbk(lglw, _dx, _dy, lglw->mouse.button_state);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_xi2_raw_motion_select
+//  Select / deselect XI_RawMotion events (root window)
+//   Return: LGLW_TRUE if raw motion events are delivered (XInput 2 available)
+static lglw_bool_t loc_xi2_raw_motion_select(lglw_int_t *lglw, lglw_bool_t _bEnable) {
+   lglw_bool_t r = LGLW_FALSE;
+
+#if LGLW_USE_XINPUT2
+   if(0 == lglw->mouse.relative.xi_opcode)
+   {
+      // (note) XIQueryVersion() must be called once per connection before any other XInput 2 request
+      // (note) XInput >= 2.1 delivers raw events to the root window regardless of pointer grabs, i.e. also
+      //         while the host holds a grab (with XInput 2.0, only the grabbing client receives them)
+      int opcode, event, error;
+      int major = 2, minor = 2;
+
+      lglw->mouse.relative.xi_opcode = -1;
+
+      if(XQueryExtension(lglw->xdsp, "XInputExtension", &opcode, &event, &error))
+      {
+         if( (Success == XIQueryVersion(lglw->xdsp, &major, &minor)) && ( (major > 2) || ((2 == major) && (minor >= 1)) ) )
+         {
+            lglw->mouse.relative.xi_opcode = opcode;
+         }
+      }
+
+      Dlog_v("lglw:loc_xi2_raw_motion_select: XInput version=%d.%d opcode=%d\n", major, minor, lglw->mouse.relative.xi_opcode);
+   }
+
+   if(lglw->mouse.relative.xi_opcode > 0)
+   {
+      unsigned char mask[XIMaskLen(XI_LASTEVENT)];
+      XIEventMask evMask;
+
+      memset(mask, 0, sizeof(mask));
+      if(_bEnable)
+      {
+         XISetMask(mask, XI_RawMotion);
+         XISetMask(mask, XI_HierarchyChanged);  // device ids may be reused by hotplugged devices (see loc_xi2_source_is_absolute())
+
+         // (note) the valuator mode is re-queried per grab (see loc_xi2_source_is_absolute())
+         memset(lglw->mouse.relative.xi_source_modes, 0, sizeof(lglw->mouse.relative.xi_source_modes));
+         lglw->mouse.relative.b_raw_absolute = LGLW_FALSE;
+      }
+
+      // (note) raw events are only delivered to the root window
+      evMask.deviceid = XIAllMasterDevices;
+      evMask.mask_len = sizeof(mask);
+      evMask.mask     = mask;
+      XISelectEvents(lglw->xdsp, DefaultRootWindow(lglw->xdsp), &evMask, 1);
+      XFlush(lglw->xdsp);
+
+      r = LGLW_TRUE;
+   }
+#else
+   (void)lglw;
+   (void)_bEnable;
+#endif // LGLW_USE_XINPUT2
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_xi2_event
+static void loc_handle_xi2_event(lglw_int_t *lglw, XGenericEventCookie *_cookie) {
+
+#if LGLW_USE_XINPUT2
+   if( (_cookie->extension == lglw->mouse.relative.xi_opcode) && XGetEventData(lglw->xdsp, _cookie) )
+   {
+      if(XI_HierarchyChanged == _cookie->evtype)
+      {
+         // (note) a removed device's id may be reassigned to a device with a different valuator mode
+         memset(lglw->mouse.relative.xi_source_modes, 0, sizeof(lglw->mouse.relative.xi_source_modes));
+      }
+      else if( (XI_RawMotion == _cookie->evtype) && lglw->mouse.relative.b_raw && (LGLW_MOUSE_GRAB_RELATIVE == lglw->mouse.grab.mode) )
+      {
+         const XIRawEvent *raw = (const XIRawEvent*)_cookie->data;
+
+         // (note) raw events of absolute devices (tablets, touchscreens, virtual machine / VNC pointers) carry device
+         //         coordinates, not deltas. the core motion (warp) fallback handles these (see loc_eventProc())
+         //         (the server delivers the raw event before the core MotionNotify event that it generates)
+         lglw->mouse.relative.b_raw_absolute = loc_xi2_source_is_absolute(lglw, raw->sourceid);
+
+         if(!lglw->mouse.relative.b_raw_absolute)
+         {
+            // (note) raw_values are unaccelerated (sub-pixel) device deltas, packed in valuator mask order
+            const double *val = raw->raw_values;
+            double dx = 0.0;
+            double dy = 0.0;
+
+            if( (raw->valuators.mask_len > 0) && XIMaskIsSet(raw->valuators.mask, 0) )
+               dx = *val++;
+
+            if( (raw->valuators.mask_len > 0) && XIMaskIsSet(raw->valuators.mask, 1) )
+               dy = *val;
+
+            Dlog_vvv("lglw:loc_handle_xi2_event: raw motion delta=(%f; %f)\n", dx, dy);
+
+            if( (0.0 != dx) || (0.0 != dy) )
+               loc_handle_mouse_relative(lglw, (float)dx, (float)dy);
+         }
+      }
+
+      XFreeEventData(lglw->xdsp, _cookie);
+   }
+#else
+   (void)lglw;
+   (void)_cookie;
+#endif // LGLW_USE_XINPUT2
+}
+
+
+#if LGLW_USE_XINPUT2
+// ---------------------------------------------------------------------------- loc_xi2_source_is_absolute
+//  Check whether the x/y valuators of the given (slave) device report absolute coordinates
+//   (note) the mode is queried once per device and grab (XIQueryDevice() is a server round trip)
+//   Return: LGLW_FALSE for relative devices, or when the device is unknown
+static lglw_bool_t loc_xi2_source_is_absolute(lglw_int_t *lglw, int _sourceId) {
+   lglw_bool_t r = LGLW_FALSE;
+   uint8_t mode = 0u;
+
+   if( (_sourceId >= 0) && ((unsigned int)_sourceId < LGLW_XI2_MAX_DEVICES) )
+      mode = lglw->mouse.relative.xi_source_modes[_sourceId];
+
+   if(0u == mode)
+   {
+      int numDevices = 0;
+      XIDeviceInfo *info = XIQueryDevice(lglw->xdsp, _sourceId, &numDevices);
+
+      if(NULL != info)
+      {
+         int i;
+
+         mode = 1u;
+
+         for(i = 0; i < info[0].num_classes; i++)
+         {
+            const XIValuatorClassInfo *valuator = (const XIValuatorClassInfo*)info[0].classes[i];
+
+            if( (XIValuatorClass == valuator->type) && (valuator->number <= 1) && (XIModeAbsolute == valuator->mode) )
+            {
+               mode = 2u;
+               break;
+            }
+         }
+
+         XIFreeDeviceInfo(info);
+
+         Dlog_v("lglw:loc_xi2_source_is_absolute: device id=%d absolute=%d\n", _sourceId, (2u == mode));
+
+         if( (_sourceId >= 0) && ((unsigned int)_sourceId < LGLW_XI2_MAX_DEVICES) )
+            lglw->mouse.relative.xi_source_modes[_sourceId] = mode;
+      }
+   }
+
+   r = (2u == mode);
+
+   return r;
+}
+#endif // LGLW_USE_XINPUT2
+
+
+// ---------------------------------------------------------------------------- loc_pointer_barriers_create
+//  Confine pointer to the window with XFixes pointer barriers (one per window edge)
+//   (note) the barriers are placed at the window position at grab time (the window is not expected to move while grabbed)
+//   Return: LGLW_FALSE when pointer barriers are not available (XFixes < 5)
+static lglw_bool_t loc_pointer_barriers_create(lglw_int_t *lglw) {
+   Window root = DefaultRootWindow(lglw->xdsp);
+   Window child;
+   int x1, y1, x2, y2;
+
+   if(0 == lglw->mouse.relative.xfixes_major)
+   {
+      // (note) XFixesQueryVersion() must be called once per connection before any other XFixes request
+      int event, error;
+      int major = 5, minor = 0;
+
+      lglw->mouse.relative.xfixes_major = -1;
+
+      if(XFixesQueryExtension(lglw->xdsp, &event, &error) && XFixesQueryVersion(lglw->xdsp, &major, &minor))
+         lglw->mouse.relative.xfixes_major = major;
+
+      Dlog_v("lglw:loc_pointer_barriers_create: XFixes version=%d.%d\n", major, minor);
+   }
+
+   if(lglw->mouse.relative.xfixes_major < 5)
+      return LGLW_FALSE;
+
+   if(!XTranslateCoordinates(lglw->xdsp, lglw->win.xwnd, root, 0, 0, &x1, &y1, &child))
+      return LGLW_FALSE;
+
+   x2 = x1 + lglw->win.size.x;
+   y2 = y1 + lglw->win.size.y;
+
+   // (note) directions specify in which direction the pointer may pass the barrier
+   lglw->mouse.relative.barriers[0] = XFixesCreatePointerBarrier(lglw->xdsp, root, x1, y1, x1, y2, BarrierPositiveX, 0, NULL);
+   lglw->mouse.relative.barriers[1] = XFixesCreatePointerBarrier(lglw->xdsp, root, x2, y1, x2, y2, BarrierNegativeX, 0, NULL);
+   lglw->mouse.relative.barriers[2] = XFixesCreatePointerBarrier(lglw->xdsp, root, x1, y1, x2, y1, BarrierPositiveY, 0, NULL);
+   lglw->mouse.relative.barriers[3] = XFixesCreatePointerBarrier(lglw->xdsp, root, x1, y2, x2, y2, BarrierNegativeY, 0, NULL);
+   XFlush(lglw->xdsp);
+
+   Dlog_v("lglw:loc_pointer_barriers_create: rect=(%d; %d)-(%d; %d)\n", x1, y1, x2, y2);
+
+   return LGLW_TRUE;
+}
+
+
+// ---------------------------------------------------------------------------- loc_pointer_barriers_destroy
+static void loc_pointer_barriers_destroy(lglw_int_t *lglw) {
+   uint32_t i;
+
+   for(i = 0u; i < 4u; i++)
+   {
+      if(0 != lglw->mouse.relative.barriers[i])
+      {
+         XFixesDestroyPointerBarrier(lglw->xdsp, lglw->mouse.relative.barriers[i]);
+         lglw->mouse.relative.barriers[i] = 0;
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_relative_callback_set
+void lglw_mouse_relative_callback_set(lglw_t _lglw, lglw_mouse_relative_fxn_t _cbk) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->mouse.relative.cbk = _cbk;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_motion_coalesce_set
+void lglw_mouse_motion_coalesce_set(lglw_t _lglw, lglw_bool_t _bEnable) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->mouse.motion.b_coalesce = _bEnable;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_motion_info_get
+uint32_t lglw_mouse_motion_info_get(lglw_t _lglw, int32_t *_retDX, int32_t *_retDY) {
+   uint32_t r = 0u;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      r = lglw->mouse.motion.num_merged;
+
+      if(NULL != _retDX)
+         *_retDX = lglw->mouse.motion.delta.x;
+
+      if(NULL != _retDY)
+         *_retDY = lglw->mouse.motion.delta.y;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_callback_set
+void lglw_mouse_callback_set(lglw_t _lglw, lglw_mouse_fxn_t _cbk) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->mouse.cbk = _cbk;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_callback_set
+void lglw_focus_callback_set(lglw_t _lglw, lglw_focus_fxn_t _cbk) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->focus.cbk = _cbk;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_xkey
+//  Translate KeyPress / KeyRelease event
+static lglw_bool_t loc_handle_xkey(lglw_int_t *lglw, XKeyEvent *_ev) {
+   lglw_bool_t bPressed = (KeyPress == _ev->type);
+   int index = (0u != (_ev->state & ShiftMask)) ? 1 : 0;
+   KeySym xks;
+   uint32_t vkey;
+
+   // (note) XLookupKeysym() ignores NumLock (Mod2). keypad digits are on the second level.
+   if(0u != (_ev->state & Mod2Mask))
+   {
+      xks = XLookupKeysym(_ev, 1);
+      if(IsKeypadKey(xks))
+         index ^= 1;
+   }
+
+   xks = XLookupKeysym(_ev, index);
+   if(NoSymbol == xks)
+      xks = XLookupKeysym(_ev, 0);
+
+   loc_kmod_sync(lglw, _ev->state);
+
+   // Auto-repeat
+   {
+      uint8_t *down = &lglw->keyboard.down[(_ev->keycode >> 3) & 31u];
+      uint8_t bit = (uint8_t)(1u << (_ev->keycode & 7u));
+
+      if(bPressed)
+      {
+         if(0u != (*down & bit))
+         {
+            lglw->keyboard.repeat_count++;
+
+            if(!lglw->keyboard.b_repeat)
+               return LGLW_TRUE;
+         }
+         else
+         {
+            *down |= bit;
+            lglw->keyboard.repeat_count = 0u;
+         }
+      }
+      else
+      {
+         // (note) the synthetic KeyRelease is skipped. the following KeyPress is then seen as a repeat (key is still down).
+         if(!lglw->keyboard.b_detectable_repeat && loc_key_is_autorepeat_release(lglw, _ev))
+            return LGLW_TRUE;
+
+         *down &= (uint8_t)~bit;
+         lglw->keyboard.repeat_count = 0u;
+      }
+   }
+
+   if(NoSymbol == xks)
+   {
+      Dlog("lglw:loc_handle_xkey: UNKNOWN keycode: %x\n", _ev->keycode);
+      return LGLW_FALSE;
+   }
+
+   if(xks < 0x100u)
+   {
+      // Latin-1
+      vkey = (uint32_t)xks;
+   }
+   else if(0x01000000u == (xks & 0xFF000000u))
+   {
+      // Unicode
+      vkey = (uint32_t)(xks & 0x00FFFFFFu);
+   }
+   else if(LGLW_KEYSYM_IDX(xks) < LGLW_KEYSYM_TABLE_SIZE)
+   {
+      const lglw_keysym_entry_t *ent = &loc_keysym_table[LGLW_KEYSYM_IDX(xks)];
+
+      if(0u != ent->kmod)
+      {
+         if(bPressed)
+            lglw->keyboard.kmod_state |= ent->kmod;
+         else
+            lglw->keyboard.kmod_state &= ~ent->kmod;
+
+         // (note) modifier events are also passed to the parent window
+         (void)loc_handle_key(lglw, bPressed, ent->vkey);
+         return LGLW_FALSE;
+      }
+
+      vkey = ent->vkey;
+
+      if(0u == vkey)
+      {
+         Dlog("lglw:loc_handle_xkey: unmapped keysym: %lx\n", xks);
+         return LGLW_FALSE;
+      }
+   }
+   else
+   {
+      // Legacy keysym pages (Latin-2..4, Cyrillic, Greek, ..)
+      vkey = loc_keysym_to_ucs(xks);
+
+      if(0u == vkey)
+      {
+         Dlog("lglw:loc_handle_xkey: unmapped keysym: %lx\n", xks);
+         return LGLW_FALSE;
+      }
+   }
+
+   Dlog_v("lglw:loc_handle_xkey: keycode=%x keysym=%lx vkey=%x bPressed=%d\n", _ev->keycode, xks, vkey, bPressed);
+
+   return loc_handle_key(lglw, bPressed, vkey);
+}
+
+
+// ---------------------------------------------------------------------------- loc_keysym_to_ucs
+//  Map legacy (pre-Unicode) keysym to Unicode character code
+//   Return: character code or 0 (unmapped)
+static uint32_t loc_keysym_to_ucs(KeySym _xks) {
+   uint32_t page = (uint32_t)(_xks >> 8);
+   uint32_t idx  = (uint32_t)(_xks & 0xFFu);
+
+   if( (page >= 1u) && (page <= LGLW_KEYSYM_UCS_NUM_PAGES) && (idx >= LGLW_KEYSYM_UCS_PAGE_BASE) )
+      return loc_keysym_ucs_table[page - 1u][idx - LGLW_KEYSYM_UCS_PAGE_BASE];
+
+   switch(_xks)
+   {
+      case XK_overline:    return 0x203Eu;
+      case XK_OE:          return 0x0152u;
+      case XK_oe:          return 0x0153u;
+      case XK_Ydiaeresis:  return 0x0178u;
+      case XK_EuroSign:    return 0x20ACu;
+   }
+
+   return 0u;
+}
+
+
+// ---------------------------------------------------------------------------- loc_key_is_autorepeat_release
+//  Check whether a KeyRelease is directly followed by a KeyPress of the same key (same timestamp)
+//   (note) fallback for servers that don't support detectable auto-repeat
+static lglw_bool_t loc_key_is_autorepeat_release(lglw_int_t *lglw, XKeyEvent *_ev) {
+   lglw_bool_t r = LGLW_FALSE;
+
+   if( (_ev->display == lglw->xdsp) && (XEventsQueued(lglw->xdsp, QueuedAfterReading) > 0) )
+   {
+      XEvent xevNext;
+      XPeekEvent(lglw->xdsp, &xevNext);
+
+      r = (KeyPress == xevNext.type)                &&
+          (xevNext.xkey.window  == _ev->window)     &&
+          (xevNext.xkey.keycode == _ev->keycode)    &&
+          (xevNext.xkey.time    == _ev->time)       ;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- loc_kmod_sync
+//  Update modifier state from an event's state field (catches transitions that happened while the window was not focused)
+//   (note) X11 does not tell left from right. the left key is assumed when the side is unknown.
+static void loc_kmod_sync(lglw_int_t *lglw, unsigned int _state) {
+   static const struct {
+      unsigned int mask;
+      uint32_t     kmod;
+      uint32_t     kmod_default;
+   } groups[4] = {
+      { ShiftMask,                    LGLW_KMOD_SHIFT, LGLW_KMOD_LSHIFT },
+      { ControlMask,                  LGLW_KMOD_CTRL,  LGLW_KMOD_LCTRL  },
+      { Mod1Mask | Mod5Mask/*AltGr*/, LGLW_KMOD_ALT,   LGLW_KMOD_LALT   },
+      { Mod4Mask,                     LGLW_KMOD_SUPER, LGLW_KMOD_LSUPER },
+   };
+   uint32_t kmod = lglw->keyboard.kmod_state;
+   uint32_t i;
+
+   for(i = 0u; i < 4u; i++)
+   {
+      if(0u == (_state & groups[i].mask))
+         kmod &= ~groups[i].kmod;
+      else if(0u == (kmod & groups[i].kmod))
+         kmod |= groups[i].kmod_default;
+   }
+
+   lglw->keyboard.kmod_state = kmod;
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_key
+static lglw_bool_t loc_handle_key(lglw_int_t *lglw, lglw_bool_t _bPressed, uint32_t _vkey) {
+   lglw_bool_t r = LGLW_FALSE;
+
+   if(lglw->queue.b_enable)
+   {
+      lglw_event_t *ev = loc_event_queue_alloc(lglw, LGLW_EVENT_KEYBOARD);
+      if(NULL != ev)
+      {
+         ev->u.keyboard.vkey         = _vkey;
+         ev->u.keyboard.kmod         = lglw->keyboard.kmod_state;
+         ev->u.keyboard.b_pressed    = _bPressed;
+         ev->u.keyboard.repeat_count = lglw->keyboard.repeat_count;
+      }
+
+      // (note) queued key events are never forwarded to the parent window
+      r = LGLW_TRUE;
+   }
+   else if(NULL != lglw->keyboard.cbk)
+   {
+      r = lglw->keyboard.cbk(lglw, _vkey, lglw->keyboard.kmod_state, _bPressed);
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_keyboard_callback_set
+void lglw_keyboard_callback_set(lglw_t _lglw, lglw_keyboard_fxn_t _cbk) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->keyboard.cbk = _cbk;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_keyboard_get_modifiers
+uint32_t lglw_keyboard_get_modifiers(lglw_t _lglw) {
+   uint32_t r = 0u;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      r = lglw->keyboard.kmod_state;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_keyboard_clear_modifiers
+void lglw_keyboard_clear_modifiers(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->keyboard.kmod_state = 0;
+      memset(lglw->keyboard.down, 0, sizeof(lglw->keyboard.down));
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_keyboard_repeat_set
+void lglw_keyboard_repeat_set(lglw_t _lglw, lglw_bool_t _bEnable) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->keyboard.b_repeat = _bEnable;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_keyboard_get_repeat_count
+uint32_t lglw_keyboard_get_repeat_count(lglw_t _lglw) {
+   uint32_t r = 0u;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      r = lglw->keyboard.repeat_count;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_touchkeyboard_show
+void lglw_touchkeyboard_show(lglw_t _lglw, lglw_bool_t _bEnable) {
+   LGLW(_lglw);
+
+   // (todo) implement me
+
+   if(NULL != lglw)
+   {
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_get_buttons
+uint32_t lglw_mouse_get_buttons(lglw_t _lglw) {
+   uint32_t r = 0u;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      r = lglw->mouse.button_state;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_grab
+void lglw_mouse_grab(lglw_t _lglw, uint32_t _grabMode) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         if(!lglw->mouse.touch.b_enable)
+         {
+            if(lglw->mouse.grab.mode != _grabMode)
+            {
+               lglw_mouse_ungrab(_lglw);
+            }
+
+            int result;
+
+            switch(_grabMode)
+            {
+               default:
+               case LGLW_MOUSE_GRAB_NONE:
+                  break;
+
+               case LGLW_MOUSE_GRAB_CAPTURE:
+                  result = XGrabPointer(lglw->xdsp, lglw->win.xwnd,
+                                        True/*owner_events*/,
+                                        NoEventMask/*event_mask*/,
+                                        GrabModeAsync/*pointer_mode*/,
+                                        GrabModeAsync/*keyboard_mode*/,
+                                        lglw->win.xwnd/*confine_to*/,
+                                        None/*cursor*/,
+                                        CurrentTime/*time*/);
+                  if(GrabSuccess != result)
+                  {
+                     Dlog("lglw: Grab Result: %i\n", result);
+                  }
+                  else
+                  {
+                     lglw->mouse.grab.mode = _grabMode;
+                  }
+                  break;
+
+               case LGLW_MOUSE_GRAB_WARP:
+                  result = XGrabPointer(lglw->xdsp, lglw->win.xwnd,
+                                        True/*owner_events*/,
+                                        NoEventMask/*event_mask*/,
+                                        GrabModeAsync/*pointer_mode*/,
+                                        GrabModeAsync/*keyboard_mode*/,
+                                        lglw->win.xwnd/*confine_to*/,
+                                        None/*cursor*/,
+                                        CurrentTime/*time*/);
+                  if(GrabSuccess != result)
+                  {
+                     Dlog("lglw: Grab Result: %i\n", result);
+                  }
+                  else
+                  {
+                     lglw_mouse_cursor_show(_lglw, LGLW_FALSE);
+                     lglw->mouse.grab.p = lglw->mouse.p;
+                     lglw->mouse.grab.last_p = lglw->mouse.p;
+                     lglw->mouse.grab.mode = _grabMode;
+                  }
+                  break;
+
+               case LGLW_MOUSE_GRAB_RELATIVE:
+                  // (note) already grabbed: keep the existing barriers / XI selection (they could not be destroyed after being replaced)
+                  if(LGLW_MOUSE_GRAB_RELATIVE == lglw->mouse.grab.mode)
+                     break;
+
+                  // (note) the pointer is confined to the window. raw motion deltas are still reported when it hits the window edge.
+                  // (note) pointer barriers don't need a grab (an active grab fails while the host holds one)
+                  if(loc_pointer_barriers_create(lglw))
+                  {
+                     result = GrabSuccess;
+                  }
+                  else
+                  {
+                     result = XGrabPointer(lglw->xdsp, lglw->win.xwnd,
+                                           True/*owner_events*/,
+                                           NoEventMask/*event_mask*/,
+                                           GrabModeAsync/*pointer_mode*/,
+                                           GrabModeAsync/*keyboard_mode*/,
+                                           lglw->win.xwnd/*confine_to*/,
+                                           None/*cursor*/,
+                                           CurrentTime/*time*/);
+                     lglw->mouse.relative.b_grabbed = (GrabSuccess == result);
+                  }
+
+                  if(GrabSuccess != result)
+                  {
+                     Dlog("lglw: Grab Result: %i\n", result);
+                  }
+                  else
+                  {
+                     lglw_mouse_cursor_show(_lglw, LGLW_FALSE);
+                     lglw->mouse.grab.p = lglw->mouse.p;
+                     lglw->mouse.grab.last_p = lglw->mouse.p;
+                     lglw->mouse.grab.mode = _grabMode;
+                     lglw->mouse.relative.b_raw = loc_xi2_raw_motion_select(lglw, LGLW_TRUE);
+                     loc_mouse_relative_owner = lglw;
+                     Dlog_v("lglw:lglw_mouse_grab: relative mode (raw=%d)\n", lglw->mouse.relative.b_raw);
+                  }
+                  break;
+            }
+         }
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_ungrab
+void lglw_mouse_ungrab(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         if(!lglw->mouse.touch.b_enable)
+         {
+            switch(lglw->mouse.grab.mode)
+            {
+               default:
+               case LGLW_MOUSE_GRAB_NONE:
+                  break;
+
+               case LGLW_MOUSE_GRAB_CAPTURE:
+                  XUngrabPointer(lglw->xdsp, CurrentTime);
+                  lglw->mouse.grab.mode = LGLW_MOUSE_GRAB_NONE;
+                  break;
+
+               case LGLW_MOUSE_GRAB_WARP:
+                  XUngrabPointer(lglw->xdsp, CurrentTime);
+                  lglw->mouse.grab.mode = LGLW_MOUSE_GRAB_NONE;
+                  lglw->mouse.grab.b_queue_warp = LGLW_TRUE;
+                  lglw_mouse_cursor_show(_lglw, LGLW_TRUE);
+                  break;
+
+               case LGLW_MOUSE_GRAB_RELATIVE:
+                  if(lglw->mouse.relative.b_raw)
+                  {
+                     (void)loc_xi2_raw_motion_select(lglw, LGLW_FALSE);
+                     lglw->mouse.relative.b_raw = LGLW_FALSE;
+                  }
+                  if(loc_mouse_relative_owner == lglw)
+                     loc_mouse_relative_owner = NULL;
+                  loc_pointer_barriers_destroy(lglw);
+                  if(lglw->mouse.relative.b_grabbed)
+                  {
+                     XUngrabPointer(lglw->xdsp, CurrentTime);
+                     lglw->mouse.relative.b_grabbed = LGLW_FALSE;
+                  }
+                  lglw->mouse.grab.mode = LGLW_MOUSE_GRAB_NONE;
+                  lglw->mouse.grab.b_queue_warp = LGLW_TRUE;  // pointer reappears at the grab start position
+                  lglw_mouse_cursor_show(_lglw, LGLW_TRUE);
+                  break;
+            }
+         }
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_warp
+void lglw_mouse_warp(lglw_t _lglw, int32_t _x, int32_t _y) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         XWarpPointer(lglw->xdsp,
+                      None/*src_w*/,
+                      lglw->win.xwnd/*dest_w*/,
+                      0/*src_x*/,
+                      0/*src_y*/,
+                      0/*src_width*/,
+                      0/*src_height*/,
+                      _x/*dest_x*/,
+                      _y/*dest_y*/);
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_queued_mouse_warp
+static void loc_handle_queued_mouse_warp(lglw_int_t *lglw) {
+   if(lglw->mouse.grab.b_queue_warp)
+   {
+      lglw->mouse.grab.b_queue_warp = LGLW_FALSE;
+      lglw_mouse_warp(lglw, lglw->mouse.grab.p.x, lglw->mouse.grab.p.y);
+      lglw->mouse.grab.last_p = lglw->mouse.grab.p;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_cursor_show
+void lglw_mouse_cursor_show (lglw_t _lglw, lglw_bool_t _bShow) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->cursor.b_hidden = !_bShow;
+      loc_cursor_update(lglw);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_cursor_update
+//  Assign current (or blank) cursor to window
+//   (note) skips the request when the window already uses that cursor
+static void loc_cursor_update(lglw_int_t *lglw) {
+   Cursor cursor = lglw->cursor.b_hidden ? (Cursor)lglw_cursor_standard_get(lglw, LGLW_CURSOR_BLANK) : lglw->cursor.current;
+
+   if( (0 != lglw->win.xwnd) && (cursor != lglw->cursor.defined) )
+   {
+      if(None != cursor)
+         XDefineCursor(lglw->xdsp, lglw->win.xwnd, cursor);
+      else
+         XUndefineCursor(lglw->xdsp, lglw->win.xwnd);
+
+      lglw->cursor.defined = cursor;
+      XFlush(lglw->xdsp);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_cursor_standard_get
+lglw_cursor_t lglw_cursor_standard_get(lglw_t _lglw, uint32_t _shape) {
+   Cursor r = None;
+   LGLW(_lglw);
+
+   if(NULL != lglw && NULL != lglw->dcache && _shape < LGLW_NUM_CURSORS)
+   {
+      lglw_display_cache_t *dcache = lglw->dcache;
+      Cursor n;
+
+      pthread_mutex_lock(&loc_display_cache.mtx);
+      r = dcache->cursors[_shape];
+      pthread_mutex_unlock(&loc_display_cache.mtx);
+
+      if( (None != r) || (LGLW_CURSOR_DEFAULT == _shape) )
+         return (lglw_cursor_t)r;
+
+      // (note) the cursor is created outside of the cache lock, i.e. a slow (or dead) server does not block
+      //         other threads that create or destroy instances (see loc_display_cache_ref())
+      if(LGLW_CURSOR_BLANK == _shape)
+      {
+         static char pxmNoData[] = {0, 0, 0, 0, 0, 0, 0, 0};
+         XColor black;
+         Pixmap noPxm;
+
+         // (note) pixmap cursors use the RGB values as-is (no colormap allocation needed)
+         memset(&black, 0, sizeof(black));
+         noPxm = XCreateBitmapFromData(dcache->xdsp, RootWindow(dcache->xdsp, dcache->screen), pxmNoData, 8, 8);
+         n = XCreatePixmapCursor(dcache->xdsp, noPxm, noPxm, &black, &black, 0, 0);
+         XFreePixmap(dcache->xdsp, noPxm);
+      }
+      else
+      {
+         static const unsigned int shapes[LGLW_NUM_CURSORS] = {
+            0u,                    // LGLW_CURSOR_DEFAULT
+            0u,                    // LGLW_CURSOR_BLANK
+            XC_left_ptr,           // LGLW_CURSOR_ARROW
+            XC_xterm,              // LGLW_CURSOR_TEXT
+            XC_crosshair,          // LGLW_CURSOR_CROSSHAIR
+            XC_hand2,              // LGLW_CURSOR_HAND
+            XC_watch,              // LGLW_CURSOR_WAIT
+            XC_sb_h_double_arrow,  // LGLW_CURSOR_RESIZE_H
+            XC_sb_v_double_arrow,  // LGLW_CURSOR_RESIZE_V
+            XC_fleur,              // LGLW_CURSOR_MOVE
+         };
+         n = XCreateFontCursor(dcache->xdsp, shapes[_shape]);
+      }
+
+      // Make sure the cursor exists before other connections refer to it
+      XSync(dcache->xdsp, False);
+
+      pthread_mutex_lock(&loc_display_cache.mtx);
+
+      // Another thread may have created the same cursor in the meantime
+      if(None == dcache->cursors[_shape])
+      {
+         dcache->cursors[_shape] = n;
+         n = None;
+      }
+
+      r = dcache->cursors[_shape];
+
+      pthread_mutex_unlock(&loc_display_cache.mtx);
+
+      if(None != n)
+         XFreeCursor(dcache->xdsp, n);
+
+      Dlog_v("lglw:lglw_cursor_standard_get: shape=%u cursor=0x%lx\n", _shape, r);
+   }
+
+   return (lglw_cursor_t)r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_cursor_create_argb
+//  (note) ARGB cursors require RENDER 0.5 (see XRenderCreateCursor())
+lglw_cursor_t lglw_cursor_create_argb(lglw_t _lglw, uint32_t _w, uint32_t _h, int32_t _hotX, int32_t _hotY, const uint32_t *_argb) {
+   Cursor r = None;
+   LGLW(_lglw);
+
+   if(NULL != lglw && NULL != lglw->xdsp && NULL != _argb && _w > 0u && _h > 0u && _w <= 0x7FFFu && _h <= 0x7FFFu)
+   {
+      int major = 0;
+      int minor = 0;
+      XRenderPictFormat *fmt = NULL;
+
+      if(XRenderQueryVersion(lglw->xdsp, &major, &minor) && ((major > 0) || (minor >= 5)))
+         fmt = XRenderFindStandardFormat(lglw->xdsp, PictStandardARGB32);
+
+      if(NULL != fmt)
+      {
+         Window root = RootWindow(lglw->xdsp, lglw->vi->screen);
+         Pixmap pxm = XCreatePixmap(lglw->xdsp, root, _w, _h, 32/*depth*/);
+         GC gc = XCreateGC(lglw->xdsp, pxm, 0/*valuemask*/, NULL/*values*/);
+         XImage *img = XCreateImage(lglw->xdsp, NULL/*visual*/, 32/*depth*/, ZPixmap, 0/*offset*/,
+                                    (char*)_argb, _w, _h, 32/*bitmap_pad*/, (int)(_w * 4u)/*bytes_per_line*/
+                                    );
+
+         if(NULL != img)
+         {
+            Picture pic;
+            const uint32_t bom = 1u;
+
+            // Pixels are in client byte order (XPutImage() converts them to the server's)
+            img->byte_order = (1u == *(const uint8_t*)&bom) ? LSBFirst : MSBFirst;
+
+            XPutImage(lglw->xdsp, pxm, gc, img, 0, 0, 0, 0, _w, _h);
+
+            img->data = NULL;  // (note) owned by caller
+            XDestroyImage(img);
+
+            // (note) hot spot must be inside the image (BadMatch)
+            if(_hotX < 0) _hotX = 0; else if((uint32_t)_hotX >= _w) _hotX = (int32_t)_w - 1;
+            if(_hotY < 0) _hotY = 0; else if((uint32_t)_hotY >= _h) _hotY = (int32_t)_h - 1;
+
+            pic = XRenderCreatePicture(lglw->xdsp, pxm, fmt, 0/*valuemask*/, NULL/*attributes*/);
+            r = XRenderCreateCursor(lglw->xdsp, pic, (unsigned int)_hotX, (unsigned int)_hotY);
+            XRenderFreePicture(lglw->xdsp, pic);
+         }
+
+         XFreeGC(lglw->xdsp, gc);
+         XFreePixmap(lglw->xdsp, pxm);
+
+         Dlog_v("lglw:lglw_cursor_create_argb: w=%u h=%u cursor=0x%lx\n", _w, _h, r);
+      }
+      else
+      {
+         Dlog("[---] lglw:lglw_cursor_create_argb: RENDER extension (0.5+) not available\n");
+      }
+   }
+
+   return (lglw_cursor_t)r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_cursor_destroy
+void lglw_cursor_destroy(lglw_t _lglw, lglw_cursor_t _cursor) {
+   LGLW(_lglw);
+
+   if(NULL != lglw && NULL != _cursor)
+   {
+      Cursor cursor = (Cursor)_cursor;
+
+      if(lglw->cursor.current == cursor)
+      {
+         lglw->cursor.current = None;
+         loc_cursor_update(lglw);
+      }
+
+      XFreeCursor(lglw->xdsp, cursor);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_cursor_set
+void lglw_cursor_set(lglw_t _lglw, lglw_cursor_t _cursor) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->cursor.current = (Cursor)_cursor;
+      loc_cursor_update(lglw);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_timer_start
+void lglw_timer_start(lglw_t _lglw, uint32_t _millisec) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      Dlog_v("lglw:lglw_timer_start: interval=%u\n", _millisec);
+
+      if(0u != lglw->timer.legacy_id)
+      {
+         lglw_timer_remove(_lglw, lglw->timer.legacy_id);
+      }
+
+      lglw->timer.legacy_id = lglw_timer_add(_lglw, (uint64_t)((_millisec > 0u) ? _millisec : 1u) * 1000000u, &loc_timer_legacy_cbk, NULL/*userData*/);
+      lglw->timer.b_running = (0u != lglw->timer.legacy_id);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_timer_stop
+void lglw_timer_stop(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      Dlog_v("lglw:lglw_timer_stop\n");
+
+      if(0u != lglw->timer.legacy_id)
+      {
+         lglw_timer_remove(_lglw, lglw->timer.legacy_id);
+         lglw->timer.legacy_id = 0u;
+      }
+
+      lglw->timer.b_running = LGLW_FALSE;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_timer_callback_set
+void lglw_timer_callback_set(lglw_t _lglw, lglw_timer_fxn_t _cbk) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      lglw->timer.cbk = _cbk;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_timer_legacy_cbk
+static void loc_timer_legacy_cbk(lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData) {
+   LGLW(_lglw);
+   (void)_timerId;
+   (void)_numMissed;  // (note) missed ticks are skipped, not replayed
+   (void)_userData;
+
+   if(NULL != lglw->timer.cbk)
+   {
+      Dlog_vvv("lglw: invoke timer callback\n");
+      lglw->timer.cbk(lglw);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_timer_add
+static uint32_t loc_timer_add(lglw_int_t *lglw, uint64_t _deadlineNS, uint64_t _intervalNS, lglw_timer_ex_fxn_t _cbk, void *_userData) {
+   uint32_t r = 0u;
+
+   if(lglw->timer.num_timers < LGLW_MAX_TIMERS)
+   {
+      lglw_timer_entry_t *t = &lglw->timer.heap[lglw->timer.num_timers];
+
+      if(0u == ++lglw->timer.next_id)
+         lglw->timer.next_id = 1u;
+
+      t->interval_ns = (_intervalNS > 0u) ? _intervalNS : 1u;
+      t->deadline_ns = _deadlineNS;
+      t->id          = lglw->timer.next_id;
+      t->cbk         = _cbk;
+      t->user_data   = _userData;
+
+      loc_timer_heap_sift_up(lglw, lglw->timer.num_timers++);
+      loc_timer_arm(lglw, lglw->timer.heap[0].deadline_ns);
+
+      r = lglw->timer.next_id;
+      Dlog_v("lglw:loc_timer_add: id=%u interval=%lluns (num_timers=%u)\n", r, (unsigned long long)_intervalNS, lglw->timer.num_timers);
+   }
+   else
+   {
+      Dlog("[---] lglw:loc_timer_add: too many timers (max=%u)\n", LGLW_MAX_TIMERS);
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_timer_add
+uint32_t lglw_timer_add(lglw_t _lglw, uint64_t _intervalNS, lglw_timer_ex_fxn_t _cbk, void *_userData) {
+   uint32_t r = 0u;
+   LGLW(_lglw);
+
+   if(NULL != lglw && NULL != _cbk)
+   {
+      if(0u == _intervalNS)
+         _intervalNS = 1u;
+
+      r = loc_timer_add(lglw, loc_time_ns() + _intervalNS, _intervalNS, _cbk, _userData);
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_timer_remove
+void lglw_timer_remove(lglw_t _lglw, uint32_t _timerId) {
+   LGLW(_lglw);
+
+   if(NULL != lglw && 0u != _timerId)
+   {
+      uint32_t idx;
+
+      for(idx = 0u; idx < lglw->timer.num_timers; idx++)
+      {
+         if(lglw->timer.heap[idx].id == _timerId)
+         {
+            Dlog_v("lglw:lglw_timer_remove: id=%u\n", _timerId);
+
+            // Move last entry into the gap and restore heap order
+            lglw->timer.num_timers--;
+            if(idx < lglw->timer.num_timers)
+            {
+               lglw->timer.heap[idx] = lglw->timer.heap[lglw->timer.num_timers];
+               loc_timer_heap_sift_up(lglw, idx);
+               loc_timer_heap_sift_down(lglw, idx);
+            }
+
+            loc_timer_arm(lglw, (lglw->timer.num_timers > 0u) ? lglw->timer.heap[0].deadline_ns : 0u/*disarm*/);
+            break;
+         }
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_timer_heap_sift_up
+static void loc_timer_heap_sift_up(lglw_int_t *lglw, uint32_t _idx) {
+   lglw_timer_entry_t *heap = lglw->timer.heap;
+
+   while(_idx > 0u)
+   {
+      uint32_t parentIdx = (_idx - 1u) >> 1;
+
+      if(heap[parentIdx].deadline_ns <= heap[_idx].deadline_ns)
+         break;
+
+      lglw_timer_entry_t t = heap[parentIdx];
+      heap[parentIdx] = heap[_idx];
+      heap[_idx] = t;
+      _idx = parentIdx;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_timer_heap_sift_down
+static void loc_timer_heap_sift_down(lglw_int_t *lglw, uint32_t _idx) {
+   lglw_timer_entry_t *heap = lglw->timer.heap;
+   uint32_t num = lglw->timer.num_timers;
+
+   for(;;)
+   {
+      uint32_t minIdx   = _idx;
+      uint32_t childIdx = (_idx << 1) + 1u;
+
+      if( (childIdx < num) && (heap[childIdx].deadline_ns < heap[minIdx].deadline_ns) )
+         minIdx = childIdx;
+
+      childIdx++;
+      if( (childIdx < num) && (heap[childIdx].deadline_ns < heap[minIdx].deadline_ns) )
+         minIdx = childIdx;
+
+      if(minIdx == _idx)
+         break;
+
+      lglw_timer_entry_t t = heap[minIdx];
+      heap[minIdx] = heap[_idx];
+      heap[_idx] = t;
+      _idx = minIdx;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_timer_arm
+static void loc_timer_arm(lglw_int_t *lglw, uint64_t _deadlineNS) {
+   if(-1 != lglw->timer.fd)
+   {
+      // (note) deadline is absolute (CLOCK_MONOTONIC). 0 disarms the timer.
+      struct itimerspec its;
+      memset(&its, 0, sizeof(its));
+      its.it_value.tv_sec  = (time_t)(_deadlineNS / 1000000000u);
+      its.it_value.tv_nsec = (long)(_deadlineNS % 1000000000u);
+      timerfd_settime(lglw->timer.fd, TFD_TIMER_ABSTIME, &its, NULL);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_process_timer()
+static void loc_process_timer(lglw_int_t *lglw) {
+   if(lglw->timer.num_timers > 0u)
+   {
+      uint64_t ns = loc_time_ns();
+
+      // Consume timerfd expiration so the event fd stops signalling (re-armed below)
+      if(-1 != lglw->timer.fd)
+      {
+         uint64_t numExpirations;
+         (void)read(lglw->timer.fd, &numExpirations, sizeof(numExpirations));
+      }
+
+      // (note) each due timer is rescheduled to a deadline > ns before its callback is invoked,
+      //         i.e. every timer fires at most once per call, even when callbacks add / remove timers
+      while( (lglw->timer.num_timers > 0u) && (lglw->timer.heap[0].deadline_ns <= ns) )
+      {
+         lglw_timer_entry_t *t = &lglw->timer.heap[0];
+
+         // Stay on the original deadline grid (no drift), skip (and report) missed ticks
+         uint64_t numMissed = (ns - t->deadline_ns) / t->interval_ns;
+         t->deadline_ns += (numMissed + 1u) * t->interval_ns;
+
+         uint32_t            id       = t->id;
+         lglw_timer_ex_fxn_t cbk      = t->cbk;
+         void               *userData = t->user_data;
+
+         loc_timer_heap_sift_down(lglw, 0u);
+
+         Dlog_vvv("lglw:loc_process_timer: invoke timer id=%u numMissed=%llu\n", id, (unsigned long long)numMissed);
+         cbk(lglw, id, (numMissed > 0xFFFFffffu) ? 0xFFFFffffu : (uint32_t)numMissed, userData);
+      }
+
+      loc_timer_arm(lglw, (lglw->timer.num_timers > 0u) ? lglw->timer.heap[0].deadline_ns : 0u/*disarm*/);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_timer_timeout_ns
+static uint64_t loc_timer_timeout_ns(lglw_int_t *lglw) {
+   uint64_t r = LGLW_EVENTS_WAIT_INFINITE;
+
+   if(lglw->timer.num_timers > 0u)
+   {
+      uint64_t ns = loc_time_ns();
+
+      if(ns >= lglw->timer.heap[0].deadline_ns)
+         r = 0u;
+      else
+         r = lglw->timer.heap[0].deadline_ns - ns;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_time_get_millisec
+uint32_t lglw_time_get_millisec(lglw_t _lglw) {
+   uint32_t r = 0u;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      r = loc_millisec_delta(lglw);
+   }
+   
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_time_get_ns
+uint64_t lglw_time_get_ns(lglw_t _lglw) {
+   (void)_lglw;
+
+   return loc_time_ns();
+}
+
+
+// ---------------------------------------------------------------------------- loc_enable_dropfiles
+static void loc_enable_dropfiles(lglw_int_t *lglw, lglw_bool_t _bEnable) {
+
+   if(0 != lglw->win.xwnd)
+   {
+      if(_bEnable)
+      {
+         Atom version = LGLW_XDND_VERSION;
+
+         XChangeProperty(lglw->xdsp, lglw->win.xwnd, lglw->atoms[LGLW_ATOM_XDND_AWARE], XA_ATOM, 32/*format*/, PropModeReplace,
+                         (unsigned char *)&version, 1);
+      }
+      else
+      {
+         XDeleteProperty(lglw->xdsp, lglw->win.xwnd, lglw->atoms[LGLW_ATOM_XDND_AWARE]);
+      }
+      XFlush(lglw->xdsp);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_handle_client_message
+//  Handle XDND target protocol messages (drop source => our window)
+//  Return: LGLW_TRUE if the message was consumed
+static lglw_bool_t loc_handle_client_message(lglw_int_t *lglw, XClientMessageEvent *_ev) {
+   const long *l = _ev->data.l;
+
+   if(_ev->message_type == lglw->atoms[LGLW_ATOM_XDND_ENTER])
+   {
+      uint32_t version = (uint32_t)((unsigned long)l[1] >> 24);
+
+      lglw->dropfiles.xdnd.source     = (Window)l[0];
+      lglw->dropfiles.xdnd.version    = (version < LGLW_XDND_VERSION) ? version : LGLW_XDND_VERSION;
+      lglw->dropfiles.xdnd.b_dropping = LGLW_FALSE;
+      lglw->dropfiles.xdnd.b_accept   = (NULL != lglw->dropfiles.cbk) && loc_xdnd_source_offers_uri_list(lglw, _ev);
+
+      Dlog_v("lglw:loc_handle_client_message: XdndEnter source=0x%lx version=%u accept=%d\n", lglw->dropfiles.xdnd.source, version, lglw->dropfiles.xdnd.b_accept);
+   }
+   else if(_ev->message_type == lglw->atoms[LGLW_ATOM_XDND_POSITION])
+   {
+      if((Window)l[0] == lglw->dropfiles.xdnd.source)
+      {
+         lglw->dropfiles.xdnd.root_x = (int32_t)((l[2] >> 16) & 0xFFFF);
+         lglw->dropfiles.xdnd.root_y = (int32_t)(l[2] & 0xFFFF);
+
+         // (note) empty rectangle + bit 1: keep sending XdndPosition messages
+         loc_xdnd_send(lglw, lglw->dropfiles.xdnd.source, LGLW_ATOM_XDND_STATUS,
+                       lglw->dropfiles.xdnd.b_accept ? 3 : 0,
+                       0/*rect x,y*/, 0/*rect w,h*/,
+                       lglw->dropfiles.xdnd.b_accept ? (long)lglw->atoms[LGLW_ATOM_XDND_ACTION_COPY] : (long)None
+                       );
+      }
+   }
+   else if(_ev->message_type == lglw->atoms[LGLW_ATOM_XDND_LEAVE])
+   {
+      if((Window)l[0] == lglw->dropfiles.xdnd.source)
+      {
+         Dlog_v("lglw:loc_handle_client_message: XdndLeave\n");
+         lglw->dropfiles.xdnd.source = 0;
+      }
+   }
+   else if(_ev->message_type == lglw->atoms[LGLW_ATOM_XDND_DROP])
+   {
+      if((Window)l[0] == lglw->dropfiles.xdnd.source)
+      {
+         Dlog_v("lglw:loc_handle_client_message: XdndDrop accept=%d\n", lglw->dropfiles.xdnd.b_accept);
+
+         if(lglw->dropfiles.xdnd.b_accept && (NULL != lglw->dropfiles.cbk))
+         {
+            // Continued in loc_xdnd_handle_selection_notify()
+            lglw->dropfiles.xdnd.b_dropping = LGLW_TRUE;
+            XConvertSelection(lglw->xdsp,
+                              lglw->atoms[LGLW_ATOM_XDND_SELECTION],
+                              lglw->atoms[LGLW_ATOM_TEXT_URI_LIST],
+                              lglw->atoms[LGLW_ATOM_XDND_RESULT],
+                              lglw->win.xwnd,
+                              (lglw->dropfiles.xdnd.version >= 1u) ? (Time)l[2] : CurrentTime
+                              );
+            XFlush(lglw->xdsp);
+         }
+         else
+         {
+            loc_xdnd_send(lglw, lglw->dropfiles.xdnd.source, LGLW_ATOM_XDND_FINISHED, 0/*rejected*/, None, 0, 0);
+            lglw->dropfiles.xdnd.source = 0;
+         }
+      }
+   }
+   else if(_ev->message_type == lglw->atoms[LGLW_ATOM_XDND_STATUS])
+   {
+      if( (NULL != lglw->drag.provider.cbk) && ((Window)l[0] == lglw->drag.target) )
+      {
+         lglw->drag.b_accepted       = (0 != (l[1] & 1));
+         lglw->drag.b_status_pending = LGLW_FALSE;
+
+         Dlog_vv("lglw:loc_handle_client_message: XdndStatus accept=%d\n", lglw->drag.b_accepted);
+
+         if(lglw->drag.b_drop_pending)
+         {
+            loc_drag_drop(lglw);
+         }
+         else if(lglw->drag.b_position_pending)
+         {
+            loc_drag_send_position(lglw);
+         }
+      }
+   }
+   else if(_ev->message_type == lglw->atoms[LGLW_ATOM_XDND_FINISHED])
+   {
+      if( lglw->drag.b_dropped && ((Window)l[0] == lglw->drag.target) )
+      {
+         Dlog_v("lglw:loc_handle_client_message: XdndFinished\n");
+         loc_drag_end(lglw);
+      }
+   }
+   else
+   {
+      return LGLW_FALSE;
+   }
+
+   return LGLW_TRUE;
+}
+
+
+// ---------------------------------------------------------------------------- loc_xdnd_send
+//  Send XDND message to drag source (target role) or drop target (source role)
+static void loc_xdnd_send(lglw_int_t *lglw, Window _dest, uint32_t _atomIdx, long _l1, long _l2, long _l3, long _l4) {
+   XClientMessageEvent ev;
+
+   memset(&ev, 0, sizeof(ev));
+   ev.type         = ClientMessage;
+   ev.display      = lglw->xdsp;
+   ev.window       = _dest;
+   ev.message_type = lglw->atoms[_atomIdx];
+   ev.format       = 32;
+   ev.data.l[0]    = (long)lglw->win.xwnd;
+   ev.data.l[1]    = _l1;
+   ev.data.l[2]    = _l2;
+   ev.data.l[3]    = _l3;
+   ev.data.l[4]    = _l4;
+
+   XSendEvent(lglw->xdsp, _dest, False/*propagate*/, NoEventMask, (XEvent*)&ev);
+   XFlush(lglw->xdsp);
+}
+
+
+// ---------------------------------------------------------------------------- loc_xdnd_source_offers_uri_list
+static lglw_bool_t loc_xdnd_source_offers_uri_list(lglw_int_t *lglw, XClientMessageEvent *_ev) {
+   const Atom uriList = lglw->atoms[LGLW_ATOM_TEXT_URI_LIST];
+   lglw_bool_t r = LGLW_FALSE;
+
+   if(_ev->data.l[1] & 1)
+   {
+      // More than three types: read XdndTypeList from source window
+      Atom returnType;
+      int returnFormat;
+      unsigned long numItems, bytesLeft;
+      unsigned char *propertyValue = NULL;
+
+      XGetWindowProperty(lglw->xdsp, (Window)_ev->data.l[0], lglw->atoms[LGLW_ATOM_XDND_TYPE_LIST],
+                         0/*offset*/,
+                         0x1FFFFFFF/*length (32bit units)*/,
+                         False/*delete*/,
+                         XA_ATOM/*req_type*/,
+                         &returnType/*actual_type_return*/,
+                         &returnFormat/*actual_format_return*/,
+                         &numItems/*nitems_return*/,
+                         &bytesLeft/*bytes_after_return*/,
+                         &propertyValue/*prop_return*/);
+
+      if(NULL != propertyValue)
+      {
+         const Atom *types = (const Atom*)propertyValue;
+         unsigned long i;
+
+         for(i = 0u; (i < numItems) && !r; i++)
+            r = (types[i] == uriList);
+
+         XFree(propertyValue);
+      }
+   }
+   else
+   {
+      r = ((Atom)_ev->data.l[2] == uriList) || ((Atom)_ev->data.l[3] == uriList) || ((Atom)_ev->data.l[4] == uriList);
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- loc_xdnd_handle_selection_notify
+static void loc_xdnd_handle_selection_notify(lglw_int_t *lglw, XSelectionEvent *_ev) {
+   lglw_bool_t bAccepted = LGLW_FALSE;
+
+   if(!lglw->dropfiles.xdnd.b_dropping)
+   {
+      // Late reply
+      if(None != _ev->property)
+         XDeleteProperty(lglw->xdsp, lglw->win.xwnd, _ev->property);
+      return;
+   }
+
+   lglw->dropfiles.xdnd.b_dropping = LGLW_FALSE;
+
+   if(None != _ev->property)
+   {
+      Atom returnType;
+      int returnFormat;
+      unsigned long numItems, bytesLeft;
+      unsigned char *propertyValue = NULL;
+
+      // (note) INCR transfers are not supported here (sources only use them for lists larger than the max. request size)
+      XGetWindowProperty(lglw->xdsp, lglw->win.xwnd, _ev->property,
+                         0/*offset*/,
+                         0x1FFFFFFF/*length (32bit units)*/,
+                         True/*delete*/,
+                         AnyPropertyType/*req_type*/,
+                         &returnType/*actual_type_return*/,
+                         &returnFormat/*actual_format_return*/,
+                         &numItems/*nitems_return*/,
+                         &bytesLeft/*bytes_after_return*/,
+                         &propertyValue/*prop_return*/);
+
+      if( (NULL != propertyValue) && (8 == returnFormat) && (NULL != lglw->dropfiles.cbk) )
+      {
+         uint32_t numPaths;
+         char **pathNames = loc_decode_uri_list((const char*)propertyValue, (uint32_t)numItems, &numPaths);
+
+         if(NULL != pathNames)
+         {
+            int x = 0, y = 0;
+            Window child;
+
+            XTranslateCoordinates(lglw->xdsp, DefaultRootWindow(lglw->xdsp), lglw->win.xwnd,
+                                  lglw->dropfiles.xdnd.root_x, lglw->dropfiles.xdnd.root_y,
+                                  &x, &y, &child
+                                  );
+
+            Dlog("lglw:loc_xdnd_handle_selection_notify: p=(%d; %d) dropped %u file(s)\n", x, y, numPaths);
+
+            if(numPaths > 0u)
+            {
+               lglw->dropfiles.cbk(lglw, x, y, numPaths, (const char**)pathNames);
+               bAccepted = LGLW_TRUE;
+            }
+
+            free(pathNames);
+         }
+      }
+      else
+      {
+         Dlog("[---] lglw:loc_xdnd_handle_selection_notify: failed to read text/uri-list (type=%lu format=%d)\n", returnType, returnFormat);
+      }
+
+      if(NULL != propertyValue)
+         XFree(propertyValue);
+   }
+
+   if(0 != lglw->dropfiles.xdnd.source)
+   {
+      loc_xdnd_send(lglw, lglw->dropfiles.xdnd.source, LGLW_ATOM_XDND_FINISHED,
+                    bAccepted ? 1 : 0,
+                    bAccepted ? (long)lglw->atoms[LGLW_ATOM_XDND_ACTION_COPY] : (long)None,
+                    0, 0
+                    );
+      lglw->dropfiles.xdnd.source = 0;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_hex_nibble
+static int loc_hex_nibble(char _c) {
+   if(_c >= '0' && _c <= '9')
+      return _c - '0';
+   if(_c >= 'a' && _c <= 'f')
+      return _c - 'a' + 10;
+   if(_c >= 'A' && _c <= 'F')
+      return _c - 'A' + 10;
+   return -1;
+}
+
+
+// ---------------------------------------------------------------------------- loc_decode_uri_list
+//  Decode text/uri-list (RFC 2483) into local path names
+//   The path array and all strings are stored in a single allocation (free() the returned pointer).
+//   Comments and non-file URIs are skipped, %XX escapes are decoded.
+static char **loc_decode_uri_list(const char *_data, uint32_t _numBytes, uint32_t *_retNumPaths) {
+   // (note) shortest accepted entry is "file:/" + line break => at most numBytes/6+1 paths. decoded paths are never longer than their URIs.
+   uint32_t maxPaths = (_numBytes / 6u) + 1u;
+   char **r = malloc((sizeof(char*) * maxPaths) + _numBytes + 1u);
+   char *d;
+   const char *s = _data;
+   const char *e = _data + _numBytes;
+   uint32_t numPaths = 0u;
+
+   *_retNumPaths = 0u;
+
+   if(NULL == r)
+      return NULL;
+
+   d = (char*)&r[maxPaths];
+
+   while(s < e)
+   {
+      const char *lineEnd = memchr(s, '\n', (size_t)(e - s));
+      const char *next;
+
+      if(NULL == lineEnd)
+         lineEnd = e;
+      next = lineEnd + 1;
+
+      // Strip CR (and trailing NUL, which some sources append)
+      while( (lineEnd > s) && (('\r' == lineEnd[-1]) || (0 == lineEnd[-1])) )
+         lineEnd--;
+
+      if( ((lineEnd - s) > 5) && (0 == memcmp(s, "file:", 5)) && (numPaths < maxPaths) )
+      {
+         s += 5;
+
+         if( ((lineEnd - s) >= 2) && ('/' == s[0]) && ('/' == s[1]) )
+         {
+            // Skip authority ("file://hostname/path")
+            s += 2;
+            while( (s < lineEnd) && ('/' != *s) )
+               s++;
+         }
+
+         if(s < lineEnd)
+         {
+            r[numPaths++] = d;
+
+            while(s < lineEnd)
+            {
+               int hi, lo;
+
+               if( ('%' == *s) && ((lineEnd - s) >= 3) && ((hi = loc_hex_nibble(s[1])) >= 0) && ((lo = loc_hex_nibble(s[2])) >= 0) )
+               {
+                  *d++ = (char)((hi << 4) | lo);
+                  s += 3;
+               }
+               else
+               {
+                  *d++ = *s++;
+               }
+            }
+            *d++ = 0;
+         }
+      }
+
+      s = next;
+   }
+
+   *_retNumPaths = numPaths;
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_drag_begin
+lglw_bool_t lglw_drag_begin(lglw_t _lglw, const char **_mimeTypes, lglw_drag_provider_fxn_t _cbk) {
+   lglw_bool_t r = LGLW_FALSE;
+   LGLW(_lglw);
+
+   if(NULL != lglw && NULL != _mimeTypes && NULL != _cbk)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         lglw_drag_cancel(_lglw);
+         lglw_mouse_ungrab(_lglw);
+
+         if(loc_selection_provider_init(lglw, &lglw->drag.provider, _mimeTypes, _cbk))
+         {
+            Time t = lglw->drag.provider.owner_time;
+            int result;
+
+            // (note) content is not requested until the target receives XdndDrop (SelectionRequest)
+            XSetSelectionOwner(lglw->xdsp, lglw->atoms[LGLW_ATOM_XDND_SELECTION], lglw->win.xwnd, t);
+
+            if(lglw->drag.provider.num_types > 3u)
+            {
+               XChangeProperty(lglw->xdsp, lglw->win.xwnd, lglw->atoms[LGLW_ATOM_XDND_TYPE_LIST], XA_ATOM, 32/*format*/, PropModeReplace,
+                               (unsigned char *)lglw->drag.provider.atoms, (int)lglw->drag.provider.num_types);
+            }
+
+            // Receive pointer events while the pointer is outside our window
+            result = XGrabPointer(lglw->xdsp, lglw->win.xwnd,
+                                  False/*owner_events*/,
+                                  PointerMotionMask | ButtonMotionMask | ButtonReleaseMask/*event_mask*/,
+                                  GrabModeAsync/*pointer_mode*/,
+                                  GrabModeAsync/*keyboard_mode*/,
+                                  None/*confine_to*/,
+                                  None/*cursor*/,
+                                  t/*time*/);
+
+            if(GrabSuccess == result)
+            {
+               lglw->drag.time = t;
+               Dlog_v("lglw:lglw_drag_begin: numTypes=%u type[0]=\"%s\"\n", lglw->drag.provider.num_types, lglw->drag.provider.mime_types[0]);
+               r = LGLW_TRUE;
+            }
+            else
+            {
+               Dlog("[---] lglw:lglw_drag_begin: XGrabPointer() failed (result=%d)\n", result);
+               (void)loc_selection_provider_free(&lglw->drag.provider);
+               XDeleteProperty(lglw->xdsp, lglw->win.xwnd, lglw->atoms[LGLW_ATOM_XDND_TYPE_LIST]);
+            }
+            XFlush(lglw->xdsp);
+         }
+      }
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_drag_cancel
+void lglw_drag_cancel(lglw_t _lglw) {
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(NULL != lglw->drag.provider.cbk)
+      {
+         Dlog_v("lglw:lglw_drag_cancel\n");
+
+         if( (0 != lglw->drag.target) && !lglw->drag.b_dropped )
+            loc_xdnd_send(lglw, lglw->drag.target, LGLW_ATOM_XDND_LEAVE, 0, 0, 0, 0);
+
+         loc_drag_end(lglw);
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_drag_is_active
+lglw_bool_t lglw_drag_is_active(lglw_t _lglw) {
+   lglw_bool_t r = LGLW_FALSE;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      r = (NULL != lglw->drag.provider.cbk);
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- loc_xdnd_find_target
+//  Find the XdndAware window at the given root position
+//   The result is cached per top-level window (child of the root window, usually the window manager frame),
+//   i.e. the window tree is only searched when the pointer enters another top-level window.
+//   Return: window or 0 (none)
+static Window loc_xdnd_find_target(lglw_int_t *lglw, int32_t _rootX, int32_t _rootY, uint32_t *_retVersion) {
+   Window root = DefaultRootWindow(lglw->xdsp);
+   Window toplevel = None;
+   int x, y;
+
+   if(!XTranslateCoordinates(lglw->xdsp, root, root, _rootX, _rootY, &x, &y, &toplevel))
+      toplevel = None;
+
+   if(toplevel != lglw->drag.toplevel)
+   {
+      lglw->drag.toplevel         = toplevel;
+      lglw->drag.toplevel_version = 0u;
+      lglw->drag.toplevel_target  = (None != toplevel) ? loc_xdnd_find_aware(lglw, toplevel, _rootX, _rootY, &lglw->drag.toplevel_version) : 0;
+
+      Dlog_vv("lglw:loc_xdnd_find_target: toplevel=0x%lx target=0x%lx\n", toplevel, lglw->drag.toplevel_target);
+   }
+
+   *_retVersion = lglw->drag.toplevel_version;
+   return lglw->drag.toplevel_target;
+}
+
+
+// ---------------------------------------------------------------------------- loc_xdnd_find_aware
+//  Find the first XdndAware window on the path from the given window down to the window at the given root position
+//   (note) XdndAware is set on the (client) top-level window, so the search usually ends one or two levels down
+//   Return: window or 0 (none)
+static Window loc_xdnd_find_aware(lglw_int_t *lglw, Window _w, int32_t _rootX, int32_t _rootY, uint32_t *_retVersion) {
+   Window root = DefaultRootWindow(lglw->xdsp);
+   Window w = _w;
+   Window child;
+   int x, y;
+
+   for(;;)
+   {
+      Atom returnType;
+      int returnFormat;
+      unsigned long numItems, bytesLeft;
+      unsigned char *propertyValue = NULL;
+
+      XGetWindowProperty(lglw->xdsp, w, lglw->atoms[LGLW_ATOM_XDND_AWARE],
+                         0/*offset*/,
+                         1/*length (32bit units)*/,
+                         False/*delete*/,
+                         XA_ATOM/*req_type*/,
+                         &returnType/*actual_type_return*/,
+                         &returnFormat/*actual_format_return*/,
+                         &numItems/*nitems_return*/,
+                         &bytesLeft/*bytes_after_return*/,
+                         &propertyValue/*prop_return*/);
+
+      if(NULL != propertyValue)
+      {
+         uint32_t version = (numItems > 0u) ? (uint32_t)*(Atom*)propertyValue : 0u;
+         XFree(propertyValue);
+
+         if(version >= 3u)
+         {
+            *_retVersion = (version < LGLW_XDND_VERSION) ? version : LGLW_XDND_VERSION;
+            return w;
+         }
+      }
+
+      if(!XTranslateCoordinates(lglw->xdsp, root, w, _rootX, _rootY, &x, &y, &child) || (None == child))
+         break;
+
+      w = child;
+   }
+
+   return 0;
+}
+
+
+// ---------------------------------------------------------------------------- loc_drag_handle_motion
+static void loc_drag_handle_motion(lglw_int_t *lglw, int32_t _rootX, int32_t _rootY, Time _time) {
+   uint32_t version = 0u;
+   Window target;
+
+   lglw->drag.root_x = _rootX;
+   lglw->drag.root_y = _rootY;
+   lglw->drag.time   = _time;
+
+   if(lglw->drag.b_dropped || lglw->drag.b_drop_pending)
+      return;
+
+   target = loc_xdnd_find_target(lglw, _rootX, _rootY, &version);
+
+   if(target != lglw->drag.target)
+   {
+      if(0 != lglw->drag.target)
+         loc_xdnd_send(lglw, lglw->drag.target, LGLW_ATOM_XDND_LEAVE, 0, 0, 0, 0);
+
+      lglw->drag.target             = target;
+      lglw->drag.target_version     = version;
+      lglw->drag.b_accepted         = LGLW_FALSE;
+      lglw->drag.b_status_pending   = LGLW_FALSE;
+      lglw->drag.b_position_pending = LGLW_FALSE;
+
+      if(0 != target)
+      {
+         const lglw_selection_provider_t *provider = &lglw->drag.provider;
+
+         Dlog_v("lglw:loc_drag_handle_motion: enter target=0x%lx version=%u\n", target, version);
+
+         loc_xdnd_send(lglw, target, LGLW_ATOM_XDND_ENTER,
+                       (long)((version << 24) | ((provider->num_types > 3u) ? 1u : 0u)),
+                       (long)provider->atoms[0],
+                       (provider->num_types > 1u) ? (long)provider->atoms[1] : (long)None,
+                       (provider->num_types > 2u) ? (long)provider->atoms[2] : (long)None
+                       );
+      }
+   }
+
+   if(0 != target)
+   {
+      // (note) only one XdndPosition in flight. the latest position is sent when XdndStatus arrives.
+      if(lglw->drag.b_status_pending)
+         lglw->drag.b_position_pending = LGLW_TRUE;
+      else
+         loc_drag_send_position(lglw);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_drag_send_position
+static void loc_drag_send_position(lglw_int_t *lglw) {
+   lglw->drag.b_status_pending   = LGLW_TRUE;
+   lglw->drag.b_position_pending = LGLW_FALSE;
+
+   loc_xdnd_send(lglw, lglw->drag.target, LGLW_ATOM_XDND_POSITION,
+                 0/*reserved*/,
+                 (long)(((lglw->drag.root_x & 0xFFFF) << 16) | (lglw->drag.root_y & 0xFFFF)),
+                 (long)lglw->drag.time,
+                 (long)lglw->atoms[LGLW_ATOM_XDND_ACTION_COPY]
+                 );
+}
+
+
+// ---------------------------------------------------------------------------- loc_drag_handle_release
+static void loc_drag_handle_release(lglw_int_t *lglw, Time _time) {
+
+   if(lglw->drag.b_dropped || lglw->drag.b_drop_pending)
+      return;
+
+   XUngrabPointer(lglw->xdsp, _time);
+   lglw->drag.time = _time;
+
+   if(0 == lglw->drag.target)
+   {
+      loc_drag_end(lglw);
+   }
+   else if(lglw->drag.b_status_pending)
+   {
+      // Continued when XdndStatus arrives
+      lglw->drag.b_drop_pending = LGLW_TRUE;
+      lglw->drag.timer_id = loc_timer_add(lglw, loc_time_ns() + LGLW_XDND_FINISHED_TIMEOUT_NS, LGLW_XDND_FINISHED_TIMEOUT_NS,
+                                          &loc_drag_timeout_cbk, NULL/*userData*/
+                                          );
+   }
+   else
+   {
+      loc_drag_drop(lglw);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_drag_drop
+static void loc_drag_drop(lglw_int_t *lglw) {
+   lglw->drag.b_drop_pending = LGLW_FALSE;
+
+   if(lglw->drag.b_accepted)
+   {
+      Dlog_v("lglw:loc_drag_drop: target=0x%lx\n", lglw->drag.target);
+
+      // Target requests the data (SelectionRequest) and then replies with XdndFinished
+      lglw->drag.b_dropped = LGLW_TRUE;
+      loc_xdnd_send(lglw, lglw->drag.target, LGLW_ATOM_XDND_DROP, 0/*reserved*/, (long)lglw->drag.time, 0, 0);
+
+      if(0u == lglw->drag.timer_id)
+      {
+         lglw->drag.timer_id = loc_timer_add(lglw, loc_time_ns() + LGLW_XDND_FINISHED_TIMEOUT_NS, LGLW_XDND_FINISHED_TIMEOUT_NS,
+                                             &loc_drag_timeout_cbk, NULL/*userData*/
+                                             );
+      }
+   }
+   else
+   {
+      Dlog_v("lglw:loc_drag_drop: rejected by target=0x%lx\n", lglw->drag.target);
+      loc_xdnd_send(lglw, lglw->drag.target, LGLW_ATOM_XDND_LEAVE, 0, 0, 0, 0);
+      loc_drag_end(lglw);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_drag_timeout_cbk
+static void loc_drag_timeout_cbk(lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData) {
+   (void)_timerId;
+   (void)_numMissed;
+   (void)_userData;
+
+   Dlog("[---] lglw:loc_drag_timeout_cbk: drop target did not respond\n");
+   lglw_drag_cancel(_lglw);
+}
+
+
+// ---------------------------------------------------------------------------- loc_drag_end
+static void loc_drag_end(lglw_int_t *lglw) {
+   lglw_clipboard_provider_fxn_t cbk;
+
+   lglw_timer_remove(lglw, lglw->drag.timer_id);
+   XUngrabPointer(lglw->xdsp, CurrentTime);
+
+   // Outgoing INCR transfers reference the provider's data
+   loc_clipboard_send_abort(lglw, lglw->atoms[LGLW_ATOM_XDND_SELECTION]);
+
+   if(lglw->drag.provider.num_types > 3u)
+      XDeleteProperty(lglw->xdsp, lglw->win.xwnd, lglw->atoms[LGLW_ATOM_XDND_TYPE_LIST]);
+
+   // Give up XdndSelection ownership
+   //  (note) ignored by the server when another client has acquired the selection in the meantime (later timestamp)
+   XSetSelectionOwner(lglw->xdsp, lglw->atoms[LGLW_ATOM_XDND_SELECTION], None, lglw->drag.provider.owner_time);
+   XFlush(lglw->xdsp);
+
+   cbk = loc_selection_provider_free(&lglw->drag.provider);
+   memset(&lglw->drag, 0, sizeof(lglw->drag));
+
+   if(NULL != cbk)
+   {
+      uint32_t numBytes;
+      Dlog_v("lglw:loc_drag_end: notify provider\n");
+      (void)cbk(lglw, NULL/*mimeType => release*/, &numBytes);
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_dropfiles_callback_set
+void lglw_dropfiles_callback_set(lglw_t _lglw, lglw_dropfiles_fxn_t _cbk) {
+   LGLW(_lglw);
+
+   if(NULL != _lglw)
+   {
+      lglw->dropfiles.cbk = _cbk;
+
+      loc_enable_dropfiles(lglw, (NULL != _cbk));
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_touchinput_set
+void lglw_touchinput_set(lglw_t _lglw, lglw_bool_t _bEnable) {
+   LGLW(_lglw);
+
+   if(NULL != _lglw)
+   {
+      lglw->mouse.touch.b_enable = _bEnable;
+      lglw->mouse.touch.b_update_queued = LGLW_TRUE;
+   }
+}
+
+
+// ---------------------------------------------------------------------------- lglw_touchinput_get
+lglw_bool_t lglw_touchinput_get(lglw_t _lglw) {
+   lglw_bool_t r = LGLW_FALSE;
+   LGLW(_lglw);
+
+   if(NULL != _lglw)
+   {
+      r = lglw->mouse.touch.b_enable;
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_clipboard_text_set
+void lglw_clipboard_text_set(lglw_t _lglw, const uint32_t _numChars, const char *_text) {
+   LGLW(_lglw);
+
+   if(NULL != _text)
+   {
+      if(NULL != _lglw)
+      {
+         if(0 != lglw->win.xwnd)
+         {
+            uint32_t numChars = (0u == _numChars) ? ((uint32_t)strlen(_text)+1u) : _numChars;
+
+            if(numChars > 0u)
+            {
+               static const char *mimeTypes[] = { "UTF8_STRING", "text/plain;charset=utf-8", NULL };
+
+               // Release previous content (incl. previous text buffer)
+               loc_clipboard_provider_release(lglw);
+
+               lglw->clipboard.numChars = numChars;
+               lglw->clipboard.data = malloc(numChars+1);
+               memcpy(lglw->clipboard.data, _text, numChars);
+               lglw->clipboard.data[numChars - 1] = 0;
+
+               Dlog("xxx lglw_clipboard_text_set(%i): %s\n", lglw->clipboard.numChars, lglw->clipboard.data);
+
+               loc_clipboard_provider_install(lglw, mimeTypes, &loc_clipboard_text_provider);
+            }
+         }
+      }
+   }
+}
+
+
+// ---------------------------------------------------------------------------- loc_clipboard_text_provider
+static const void *loc_clipboard_text_provider(lglw_t _lglw, const char *_mimeType, uint32_t *_retNumBytes) {
+   LGLW(_lglw);
+   (void)_mimeType;  // (note) UTF8_STRING and text/plain;charset=utf-8 share the same buffer
+   *_retNumBytes = lglw->clipboard.numChars;
+   return lglw->clipboard.data;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_clipboard_provider_set
+lglw_bool_t lglw_clipboard_provider_set(lglw_t _lglw, const char **_mimeTypes, lglw_clipboard_provider_fxn_t _cbk) {
+   lglw_bool_t r = LGLW_FALSE;
+   LGLW(_lglw);
+
+   if(NULL != lglw)
+   {
+      if(0 != lglw->win.xwnd)
+      {
+         loc_clipboard_provider_release(lglw);
+
+         if(NULL != _cbk && NULL != _mimeTypes)
+         {
+            r = loc_clipboard_provider_install(lglw, _mimeTypes, _cbk);
+         }
+         else
+         {
+            // Give up ownership
+            XSetSelectionOwner(lglw->xdsp, lglw->atoms[LGLW_ATOM_CLIPBOARD], None, (0u != lglw->event.server_time) ? (Time)lglw->event.server_time : CurrentTime);
+            XFlush(lglw->xdsp);
+            r = LGLW_TRUE;
+         }
+      }
+   }
+
+   return r;
+}
+
+
+// ---------------------------------------------------------------------------- loc_clipboard_provider_install
+static lglw_bool_t loc_clipboard_provider_install(lglw_int_t *lglw, const char **_mimeTypes, lglw_clipboard_provider_fxn_t _cbk) {
+
+   if(!loc_selection_provider_init(lglw, &lglw->clipboard.provider, _mimeTypes, _cbk))
+      return LGLW_FALSE;
+
+   // (note) content is not requested until another client asks for it (SelectionRequest)
+   XSetSelectionOwner(lglw->xdsp, lglw->atoms[LGLW_ATOM_CLIPBOARD], lglw->win.xwnd, lglw->clipboard.provider.owner_time);
+   XSync(lglw->xdsp, False);
+
+   Dlog_v("lglw:loc_clipboard_provider_install: numTypes=%u type[0]=\"%s\"\n", lglw->clipboard.provider.num_types, lglw->clipboard.provider.mime_types[0]);
+
+   return LGLW_TRUE;
+}
+
+
+// ---------------------------------------------------------------------------- loc_clipboard_provider_release
+//  Forget clipboard content (ownership was lost or is about to be replaced)
+static void loc_clipboard_provider_release(lglw_int_t *lglw) {
+   lglw_clipboard_provider_fxn_t cbk;
+
+   // Outgoing INCR transfers reference the provider's data (which may be freed by the release call below)
+   loc_clipboard_send_abort(lglw, lglw->atoms[LGLW_ATOM_CLIPBOARD]);
+
+   cbk = loc_selection_provider_free(&lglw->clipboard.provider);
+
+   if(NULL != cbk && &loc_clipboard_text_provider != cbk)
+   {
+      uint32_t numBytes;
+      Dlog_v("lglw:loc_clipboard_provider_release: notify provider\n");
+      (void)cbk(lglw, NULL/*mimeType => release*/, &numBytes);
+   }
+
+   free(lglw->clipboard.data);
+   lglw->clipboard.data = NULL;
+   lglw->clipboard.numChars = 0u;
+}
+
+
+// ---------------------------------------------------------------------------- loc_selection_provider_init
+static lglw_bool_t loc_selection_provider_init(lglw_int_t *lglw, lglw_selection_provider_t *_provider, const char **_mimeTypes, lglw_clipboard_provider_fxn_t _cbk) {
+   uint32_t numTypes = 0u;
+
+   while( (NULL != _mimeTypes[numTypes]) && (numTypes < LGLW_CLIPBOARD_MAX_MIME_TYPES) )
+   {
+      _provider->mime_types[numTypes] = strdup(_mimeTypes[numTypes]);
+      numTypes++;
+   }
+
+   if(0u == numTypes)
+      return LGLW_FALSE;
+
+   // Resolve all types in a single round trip
+   if(!XInternAtoms(lglw->xdsp, _provider->mime_types, (int)numTypes, False/*only_if_exists*/, _provider->atoms))
+   {
+      Dlog("[---] lglw:loc_selection_provider_init: XInternAtoms() failed\n");
+   }
+
+   _provider->num_types  = numTypes;
+   _provider->cbk        = _cbk;
+   _provider->owner_time = (0u != lglw->event.server_time) ? (Time)lglw->event.server_time : CurrentTime;
+
+   return LGLW_TRUE;
+}
 
-      Dlog_v("lglw:lglw_window_open: 4\n");
-      XSetWindowAttributes swa;
-      XSync(lglw->xdsp, False);
 
-      Dlog_v("lglw:lglw_window_open: 5\n");
-      swa.border_pixel = 0;
-      swa.colormap = lglw->cmap;
-      swa.event_mask = KeyPressMask | KeyReleaseMask | ButtonPressMask | ButtonReleaseMask | EnterWindowMask | LeaveWindowMask | PointerMotionMask | ButtonMotionMask | ExposureMask | FocusChangeMask; // NoEventMask to bubble-up to parent
-      lglw->win.xwnd = XCreateWindow(lglw->xdsp/*display*/,
-                                     DefaultRootWindow(lglw->xdsp)/*parent. see Cameron's comment below.*/,
-                                     0/*x*/,
-                                     0/*y*/,
-                                     _w/*width*/,
-                                     _h/*height*/,
-                                     0/*border_width*/,
-                                     CopyFromParent/*depth*/,
-                                     InputOutput/*class*/,
-                                     lglw->vi->visual,
-                                     CWBorderPixel | CWColormap | CWEventMask/*value_mask*/,
-                                     &swa/*attributes*/
-                                     );
+// ---------------------------------------------------------------------------- loc_selection_provider_free
+//  Return: previous callback (caller notifies the application)
+static lglw_clipboard_provider_fxn_t loc_selection_provider_free(lglw_selection_provider_t *_provider) {
+   lglw_clipboard_provider_fxn_t cbk = _provider->cbk;
+   uint32_t i;
 
-      Dlog_v("lglw:lglw_window_open: 6\n");
-      XSetStandardProperties(lglw->xdsp/*display*/,
-                             lglw->win.xwnd/*window*/,
-                             "LGLW"/*window_name*/,
-                             "LGLW"/*icon_name*/,
-                             None/*icon_pixmap*/,
-                             NULL/*argv*/,
-                             0/*argc*/,
-                             NULL/*XSizeHints*/
-                             );
+   _provider->cbk = NULL;
 
-      Dlog_v("lglw:lglw_window_open: 7\n");
+   for(i = 0u; i < _provider->num_types; i++)
+   {
+      free(_provider->mime_types[i]);
+      _provider->mime_types[i] = NULL;
+   }
+   _provider->num_types = 0u;
 
-#ifdef USE_XEVENTPROC
-      loc_setEventProc(lglw->xdsp, lglw->win.xwnd);
-#else
-      {
-         void *nowarn = &loc_setEventProc;
-         (void)nowarn;
-      }
-#endif
+   return cbk;
+}
 
-      loc_setProperty(lglw->xdsp, lglw->win.xwnd, "_lglw", (void*)lglw);  // set instance pointer
 
-      if(0 != _parentHWNDOrNull)
-      {
-#ifdef USE_XEVENTPROC
-         loc_setEventProc(lglw->xdsp, lglw->parent_xwnd);
-#endif // USE_XEVENTPROC
-         loc_setProperty(lglw->xdsp, lglw->parent_xwnd, "_lglw", (void*)lglw);  // set instance pointer
-      }
+// ---------------------------------------------------------------------------- loc_selection_provide
+//  Query content for the given type from a provider
+//   (note) earlier results may still be referenced by outgoing INCR transfers (see lglw_clipboard_provider_fxn_t)
+static const void *loc_selection_provide(lglw_int_t *lglw, lglw_selection_provider_t *_provider, Atom _target, uint32_t *_retNumBytes) {
+   uint32_t i;
 
-      // Some hosts only check and store the callback when the Window is reparented
-      // Since creating the Window with a Parent may or may not do that, but the callback is not set,
-      // ... it's created as a root window, the callback is set, and then it's reparented
-      if (0 != _parentHWNDOrNull)
+   *_retNumBytes = 0u;
+
+   if(NULL != _provider->cbk)
+   {
+      for(i = 0u; i < _provider->num_types; i++)
       {
-         Dlog_v("lglw:lglw_window_open: 8\n");
-         XReparentWindow(lglw->xdsp, lglw->win.xwnd, lglw->parent_xwnd, 0, 0);
+         if(_provider->atoms[i] == _target)
+         {
+            return _provider->cbk(lglw, _provider->mime_types[i], _retNumBytes);
+         }
       }
+   }
 
-      lglw->win.b_owner = LGLW_TRUE;
+   return NULL;
+}
 
-      Dlog_v("lglw:lglw_window_open: 9\n");
-      if(lglw->win.b_owner)
-      {
-         // // XMapRaised(lglw->xdsp, lglw->win.xwnd);
-         XMapWindow(lglw->xdsp, lglw->win.xwnd);
-      }
 
-      XSync(lglw->xdsp, False);
-      lglw->win.mapped = LGLW_TRUE;
+// ---------------------------------------------------------------------------- loc_is_clipboard_event
+static Bool loc_is_clipboard_event(Display *_display, XEvent *_xevent, XPointer _xarg) {
+   return _xevent->type == SelectionNotify;
+}
 
-      Dlog_v("lglw:lglw_window_open: 10\n");
-      lglw->win.size.x = _w;
-      lglw->win.size.y = _h;
 
-      Dlog_v("lglw:lglw_window_open: 11\n");
-      loc_enable_dropfiles(lglw, (NULL != lglw->dropfiles.cbk));
+// ---------------------------------------------------------------------------- loc_is_clipboard_chunk_event
+static Bool loc_is_clipboard_chunk_event(Display *_display, XEvent *_xevent, XPointer _xarg) {
+   lglw_int_t *lglw = (lglw_int_t*)_xarg;
+   (void)_display;
+   return
+      (PropertyNotify == _xevent->type)                                   &&
+      (PropertyNewValue == _xevent->xproperty.state)                      &&
+      (lglw->win.xwnd == _xevent->xproperty.window)                       &&
+      (lglw->atoms[LGLW_ATOM_CLIPBOARD_RESULT] == _xevent->xproperty.atom)
+      ;
+}
 
-      Dlog_v("lglw:lglw_window_open: EXIT\n");
 
-      r = LGLW_TRUE;
+// ---------------------------------------------------------------------------- loc_wait_if_event
+//  Wait for an event that matches the given predicate (see XIfEvent())
+//   Return: LGLW_FALSE on timeout (e.g. the selection owner stopped responding)
+static lglw_bool_t loc_wait_if_event(lglw_int_t *lglw, XEvent *_retEvent, Bool (*_predicate)(Display*, XEvent*, XPointer), XPointer _arg, uint64_t _timeoutNS) {
+   uint64_t deadlineNS = loc_time_ns() + _timeoutNS;
+
+   for(;;)
+   {
+      struct pollfd pfd;
+      uint64_t nowNS;
+
+      // (note) flushes the output buffer and reads all available events into the queue
+      if(XCheckIfEvent(lglw->xdsp, _retEvent, _predicate, _arg))
+         return LGLW_TRUE;
+
+      nowNS = loc_time_ns();
+      if(nowNS >= deadlineNS)
+         return LGLW_FALSE;
+
+      pfd.fd      = ConnectionNumber(lglw->xdsp);
+      pfd.events  = POLLIN;
+      pfd.revents = 0;
+      (void)poll(&pfd, 1, (int)((deadlineNS - nowNS + 999999u) / 1000000u));
    }
-   return r;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_window_resize
-lglw_bool_t lglw_window_resize (lglw_t _lglw, int32_t _w, int32_t _h) {
-   lglw_bool_t r = LGLW_FALSE;
+// ---------------------------------------------------------------------------- lglw_clipboard_text_get
+void lglw_clipboard_text_get(lglw_t _lglw, uint32_t _maxChars, uint32_t *_retNumChars, char *_retText) {
    LGLW(_lglw);
 
-   if(NULL != lglw)
+   if(NULL != _retNumChars)
+      *_retNumChars = 0u;
+
+   if(NULL != _retText)
+      *_retText = 0;
+
+   if(_maxChars > 0u)
    {
-      if(0 != lglw->hidden.xwnd)
+      if(NULL != _lglw)
       {
-         XResizeWindow(lglw->xdsp, lglw->hidden.xwnd, _w, _h);
+         if(0 != lglw->win.xwnd)
+         {
+            Window owner;
+            XEvent xev;
+            XSelectionEvent *cbReq;
+            Atom clipboard = lglw->atoms[LGLW_ATOM_CLIPBOARD];
+            Atom utf8 = lglw->atoms[LGLW_ATOM_UTF8_STRING];
+            Atom target = lglw->atoms[LGLW_ATOM_CLIPBOARD_RESULT];
 
-#ifdef LGLW_CONTEXT_ALLOW_USE_AFTER_FREE
-         // (note) [bsp] destroying the GL context also destroys all GL objects attached to it
-         //               (_if_ the GL driver is implemented correctly).
-         //               IOW, if we destroy the context here, we'd have to re-create all the textures,
-         //               buffer objects, framebuffer objects, shaders, .. before they can be used again.
-         //               Apparently this works with certain GL drivers on Linux but it still is an application error.
-         loc_destroy_gl(lglw);
-         loc_create_gl(lglw);
-#endif // LGLW_CONTEXT_ALLOW_USE_AFTER_FREE
-      }
+            owner = XGetSelectionOwner(lglw->xdsp, clipboard);
+            if(owner == None)
+            {
+               Dlog("xxx lglw_clipboard_text_get: No Window can provide a clipboard result\n");
+               return;
+            }
 
-      if(0 != lglw->win.xwnd)
-      {
-         r = LGLW_TRUE;
+            if(owner == lglw->win.xwnd)
+            {
+               Dlog("xxx lglw_clipboard_text_get: We are the owner of the clipboard, skip X interactions\n");
 
-         int deltaW = _w - lglw->win.size.x;
-         int deltaH = _h - lglw->win.size.y;
+               uint32_t numBytes;
+               const char *data = loc_selection_provide(lglw, &lglw->clipboard.provider, utf8, &numBytes);
+               uint32_t i = 0u;
+               for(; (i < _maxChars) && (i < numBytes); i++)
+               {
+                  _retText[i] = data[i];
+                  if(0 == _retText[i])
+                     break;
+               }
+               _retText[(i < _maxChars) ? i : (_maxChars - 1u)] = 0;
 
-         Dlog_v("Child Window Resize; old (%5i x %5i) new(%5i x %5i)\n", lglw->win.size.x, lglw->win.size.y, _w, _h);
+               if(NULL != _retNumChars)
+                  *_retNumChars = i;
 
-         lglw->win.size.x = _w;
-         lglw->win.size.y = _h;
+               Dlog("xxx lglw_clipboard_text_get: (result on next line)\n%s\n", _retText);
+               return;
+            }
 
-         Window root, parent, *children = NULL;
-         unsigned int num_children;
+            XConvertSelection(lglw->xdsp, clipboard, utf8, target, lglw->win.xwnd, CurrentTime);
+            if(!loc_wait_if_event(lglw, &xev, &loc_is_clipboard_event, None, LGLW_CLIPBOARD_DEFAULT_TIMEOUT_NS))
+            {
+               Dlog("[---] lglw_clipboard_text_get: clipboard owner did not respond\n");
+               return;
+            }
 
-         if(!XQueryTree(lglw->xdsp, lglw->win.xwnd, &root, &parent, &children, &num_children))
-            return r;
+            cbReq = (XSelectionEvent*)&xev;
+            if(None == cbReq->property)
+            {
+               Dlog("xxx lglw_clipboard_text_get: Clipboard was not converted to UTF-8 string\n");
+               return;
+            }
 
-         if(children)
-            XFree((char *)children);
+            Atom returnType;
+            int returnFormat;
+            unsigned long size, returnSize, bytesLeft;
+            unsigned char *propertyValue = NULL;
 
-         // Resize parent window (if any)
-         if(0 != parent)
-         {
-            int x, y;
-            unsigned int width, height;
-            unsigned int border_width;
-            unsigned int depth;
+            XGetWindowProperty(lglw->xdsp, lglw->win.xwnd, target,
+                               0/*offset*/,
+                               0/*length*/,
+                               False/*delete*/,
+                               AnyPropertyType/*req_type*/,
+                               &returnType/*actual_type_return*/,
+                               &returnFormat/*actual_format_return*/,
+                               &returnSize/*nitems_return*/,
+                               &size/*bytes_after_return*/,
+                               &propertyValue/*prop_return*/);
+            XFree(propertyValue);
 
-            if(!XGetGeometry(lglw->xdsp, lglw->win.xwnd, &root, &x, &y, &width, &height, &border_width, &depth))
-               return r;
+            if(lglw->atoms[LGLW_ATOM_INCR] == returnType)
+            {
+               // Receive chunks until the owner writes a zero-length property
+               uint32_t numChars = 0u;
 
-            Dlog_v("Parent Window Resize; old (%5i x %5i) new(%5i x %5i), delta (%5i x %5i)\n", width, height, width + deltaW, height + deltaH, deltaW, deltaH);
+               XDeleteProperty(lglw->xdsp, lglw->win.xwnd, target);  // request first chunk
 
-            XResizeWindow(lglw->xdsp, parent, width + deltaW, height + deltaH);
-         }
+               for(;;)
+               {
+                  if(!loc_wait_if_event(lglw, &xev, &loc_is_clipboard_chunk_event, (XPointer)lglw, LGLW_CLIPBOARD_INCR_TIMEOUT_NS))
+                  {
+                     Dlog("[---] lglw_clipboard_text_get: clipboard owner stopped sending INCR chunks\n");
+                     numChars = 0u;  // discard incomplete text
+                     break;
+                  }
 
-         XResizeWindow(lglw->xdsp, lglw->win.xwnd, _w, _h);
-         XRaiseWindow(lglw->xdsp, lglw->win.xwnd);
+                  XGetWindowProperty(lglw->xdsp, lglw->win.xwnd, target,
+                                     0/*offset*/,
+                                     0x1FFFFFFF/*length (32bit units)*/,
+                                     True/*delete (requests next chunk)*/,
+                                     AnyPropertyType/*req_type*/,
+                                     &returnType/*actual_type_return*/,
+                                     &returnFormat/*actual_format_return*/,
+                                     &returnSize/*nitems_return*/,
+                                     &bytesLeft/*bytes_after_return*/,
+                                     &propertyValue/*prop_return*/);
+
+                  if(NULL == propertyValue)
+                     break;
+
+                  if(0u == returnSize)
+                  {
+                     XFree(propertyValue);
+                     break;
+                  }
+
+                  // (note) keep draining chunks that don't fit so the owner can finish the transfer
+                  if(8 == returnFormat)
+                  {
+                     unsigned long k;
+                     for(k = 0u; (k < returnSize) && (numChars < (_maxChars - 1u)); k++)
+                     {
+                        _retText[numChars++] = (char)propertyValue[k];
+                     }
+                  }
+
+                  XFree(propertyValue);
+               }
+
+               _retText[numChars] = 0;
+
+               if(NULL != _retNumChars)
+                  *_retNumChars = (uint32_t)strlen(_retText);
+
+               Dlog("xxx lglw_clipboard_text_get: INCR result numChars=%u\n", numChars);
+               return;
+            }
+
+            if(utf8 != returnType)
+            {
+               Dlog("xxx lglw_clipboard_text_get: Clipboard result is not a UTF-8 string\n");
+               return;
+            }
+
+            if(8u != returnFormat)
+            {
+               Dlog("xxx lglw_clipboard_text_get: Clipboard format is not a char array\n");
+               return;
+            }
+
+            if(_maxChars < size)
+               size = _maxChars;
+            size = 1 + ((size - 1) / 4);
+
+            // TODO: Even with the largest current use-case, multiple calls aren't necessary. do it anyway just in case
+            XGetWindowProperty(lglw->xdsp, lglw->win.xwnd, target,
+                               0/*offset*/,
+                               size/*length*/,
+                               True/*delete*/,
+                               AnyPropertyType/*req_type*/,
+                               &returnType/*actual_type_return*/,
+                               &returnFormat/*actual_format_return*/,
+                               &returnSize/*nitems_return*/,
+                               &bytesLeft/*bytes_after_return*/,
+                               &propertyValue/*prop_return*/);
+
+            if(returnSize == 0)
+            {
+               Dlog("xxx lglw_clipboard_text_get: No Clipboard result after final request\n");
+               return;
+            }
+
+            uint32_t i = 0u;
+            for(; i < _maxChars; i++)
+            {
+               _retText[i] = propertyValue[i];
+               if(0 == _retText[i])
+                  break;
+            }
+            _retText[_maxChars - 1u] = 0;
+
+            if(NULL != _retNumChars)
+               *_retNumChars = i;
+
+            Dlog("xxx lglw_clipboard_text_get: (result on next line)\n%s\n", _retText);
+            XFree(propertyValue);
+         }
       }
    }
-
-   return r;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_window_close
-void lglw_window_close (lglw_t _lglw) {
+// ---------------------------------------------------------------------------- lglw_clipboard_request_async
+lglw_bool_t lglw_clipboard_request_async(lglw_t _lglw, const char *_mimeType, lglw_clipboard_fxn_t _cbk, uint64_t _timeoutNS) {
+   lglw_bool_t r = LGLW_FALSE;
    LGLW(_lglw);
 
-   if(NULL != lglw)
+   if(NULL != lglw && NULL != _cbk)
    {
       if(0 != lglw->win.xwnd)
       {
-         Dlog_v("lglw:lglw_window_close: 1\n");
-         lglw_timer_stop(_lglw);
+         // Only one request at a time
+         lglw_clipboard_request_cancel(_lglw);
 
-         Dlog_v("lglw:lglw_window_close: 2\n");
-         glXMakeCurrent(lglw->xdsp, None, NULL);
-
-         Dlog_v("lglw:lglw_window_close: 3\n");
-         if(lglw->win.b_owner)
+         if( (NULL == _mimeType) || (0 == strcmp(_mimeType, "UTF8_STRING")) )
          {
-            XUnmapWindow(lglw->xdsp, lglw->win.xwnd);
-            XDestroyWindow(lglw->xdsp, lglw->win.xwnd);
-            lglw->win.b_owner = LGLW_FALSE;
+            _mimeType = "UTF8_STRING";
+            lglw->clipboard.req.target = lglw->atoms[LGLW_ATOM_UTF8_STRING];
          }
-         XSync(lglw->xdsp, False);
-         lglw->win.xwnd = 0;
-         lglw->win.mapped = LGLW_FALSE;
-
+         else
          {
-            XEvent xev;
-            int queued = XPending(lglw->xdsp);
-            Dlog_vvv("lglw:lglw_window_close: consume %d pending events\n", queued);
-            while(queued)
-            {
-               XNextEvent(lglw->xdsp, &xev);
-               queued--;
-            }
+            lglw->clipboard.req.target = XInternAtom(lglw->xdsp, _mimeType, False/*only_if_exists*/);
          }
-      }
-   }
-   Dlog_v("lglw:lglw_window_close: EXIT\n");
-}
 
+         lglw->clipboard.req.cbk       = _cbk;
+         lglw->clipboard.req.mime_type = strdup(_mimeType);
 
-// ---------------------------------------------------------------------------- lglw_window_show
-void lglw_window_show(lglw_t _lglw) {
-   LGLW(_lglw);
-
-   if(NULL != lglw)
-   {
-      Dlog_v("lglw:lglw_window_show: 1\n");
-      XMapRaised(lglw->xdsp, lglw->win.xwnd);
-
-      lglw->win.mapped = LGLW_TRUE;
-   }
-   Dlog_v("lglw:lglw_window_show: EXIT\n");
-}
-
-
-// ---------------------------------------------------------------------------- lglw_window_hide
-void lglw_window_hide(lglw_t _lglw) {
-   LGLW(_lglw);
-
-   if(NULL != lglw)
-   {
-      Dlog_v("lglw:lglw_window_hide: 1\n");
-      XUnmapWindow(lglw->xdsp, lglw->win.xwnd);
+         if(0u == _timeoutNS)
+            _timeoutNS = LGLW_CLIPBOARD_DEFAULT_TIMEOUT_NS;
 
-      lglw->win.mapped = LGLW_FALSE;
-   }
-   Dlog_v("lglw:lglw_window_hide: EXIT\n");
-}
+         lglw->clipboard.req.timer_id = loc_timer_add(lglw, loc_time_ns() + _timeoutNS, _timeoutNS,
+                                                      &loc_clipboard_request_timeout_cbk, NULL/*userData*/
+                                                      );
 
+         // (note) when there is no owner, the server replies with a SelectionNotify (property=None) right away
+         XConvertSelection(lglw->xdsp,
+                           lglw->atoms[LGLW_ATOM_CLIPBOARD],
+                           lglw->clipboard.req.target,
+                           lglw->atoms[LGLW_ATOM_CLIPBOARD_RESULT],
+                           lglw->win.xwnd,
+                           (0u != lglw->event.server_time) ? (Time)lglw->event.server_time : CurrentTime
+                           );
+         XFlush(lglw->xdsp);
 
-// ---------------------------------------------------------------------------- lglw_window_is_visible
-lglw_bool_t lglw_window_is_visible(lglw_t _lglw) {
-   lglw_bool_t r = LGLW_FALSE;
-   LGLW(_lglw);
+         Dlog_v("lglw:lglw_clipboard_request_async: mimeType=\"%s\" timeoutNS=%llu\n", _mimeType, (unsigned long long)_timeoutNS);
 
-   // Dlog_vvv("lglw:lglw_window_is_visible: 1\n");
-   if(NULL != lglw && 0 != lglw->win.xwnd)
-   {
-      // Dlog_vvv("lglw:lglw_window_is_visible: 2\n");
-      r = lglw->win.mapped;
+         r = LGLW_TRUE;
+      }
    }
 
-   // Dlog_vvv("lglw:lglw_window_is_visible: EXIT\n");
    return r;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_window_size_get
-void lglw_window_size_get(lglw_t _lglw, int32_t *_retX, int32_t *_retY) {
+// ---------------------------------------------------------------------------- lglw_clipboard_request_cancel
+void lglw_clipboard_request_cancel(lglw_t _lglw) {
    LGLW(_lglw);
 
-   Dlog_vvv("lglw:lglw_window_size_get: 1\n");
    if(NULL != lglw)
    {
-      if(0 != lglw->win.xwnd)
+      if(NULL != lglw->clipboard.req.cbk)
       {
-         if(NULL != _retX)
-            *_retX = lglw->win.size.x;
-
-         if(NULL != _retY)
-            *_retY = lglw->win.size.y;
+         Dlog_v("lglw:lglw_clipboard_request_cancel: mimeType=\"%s\"\n", lglw->clipboard.req.mime_type);
+         loc_clipboard_request_finish(lglw, LGLW_CLIPBOARD_CANCELLED, NULL, 0u);
       }
    }
-   Dlog_vvv("lglw:lglw_window_size_get: EXIT\n");
 }
 
 
-// ---------------------------------------------------------------------------- lglw_redraw
-void lglw_redraw(lglw_t _lglw) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_clipboard_request_finish
+static void loc_clipboard_request_finish(lglw_int_t *lglw, uint32_t _status, const void *_data, uint32_t _numBytes) {
+   lglw_clipboard_fxn_t cbk = lglw->clipboard.req.cbk;
+   char *mimeType = lglw->clipboard.req.mime_type;
 
-   if(NULL != lglw)
+   // Reset request state first (callback may issue a new request)
+   lglw_timer_remove(lglw, lglw->clipboard.req.timer_id);
+   lglw->clipboard.req.timer_id  = 0u;
+   lglw->clipboard.req.cbk       = NULL;
+   lglw->clipboard.req.mime_type = NULL;
+   lglw->clipboard.req.target    = None;
+   lglw->clipboard.req.b_incr    = LGLW_FALSE;
+
+   if(NULL != cbk)
    {
-      if(0 != lglw->win.xwnd)
-      {
-         Dlog_vvv("lglw:lglw_redraw: 1\n");
-         XEvent xev;
-         xev.xany.type       = Expose;
-         xev.xany.serial     = 0;
-         xev.xany.send_event = True;
-         xev.xany.display    = lglw->xdsp;
-         xev.xany.window     = lglw->win.xwnd;
-         xev.xexpose.x      = 0;
-         xev.xexpose.y      = 0;
-         xev.xexpose.width  = lglw->win.size.x;
-         xev.xexpose.height = lglw->win.size.y;
-         xev.xexpose.count  = 0;
-         XSendEvent(lglw->xdsp, lglw->win.xwnd,
-                    True/*propagate*/,
-                    ExposureMask/*event_mask*/,
-                    &xev
-                    );
-         XFlush(lglw->xdsp);
-      }
+      Dlog_v("lglw:loc_clipboard_request_finish: status=%u numBytes=%u\n", _status, _numBytes);
+      cbk(lglw, _status, mimeType, _data, _numBytes);
    }
+
+   free(mimeType);
 }
 
 
-// ---------------------------------------------------------------------------- lglw_redraw_callback_set
-void lglw_redraw_callback_set(lglw_t _lglw, lglw_redraw_fxn_t _cbk) {
+// ---------------------------------------------------------------------------- loc_clipboard_request_timeout_cbk
+static void loc_clipboard_request_timeout_cbk(lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData) {
    LGLW(_lglw);
+   (void)_timerId;
+   (void)_numMissed;
+   (void)_userData;
 
-   if(NULL != lglw)
-   {
-      lglw->redraw.cbk = _cbk;
-   }
+   Dlog("[---] lglw:loc_clipboard_request_timeout_cbk: clipboard owner did not respond\n");
+   loc_clipboard_request_finish(lglw, LGLW_CLIPBOARD_TIMEOUT, NULL, 0u);
 }
 
 
-// ---------------------------------------------------------------------------- lglw_glcontext_push
-void lglw_glcontext_push(lglw_t _lglw) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_handle_selection_notify
+static void loc_handle_selection_notify(lglw_int_t *lglw, XSelectionEvent *_ev) {
 
-   if(NULL != lglw)
+   if( (NULL == lglw->clipboard.req.cbk) || (_ev->target != lglw->clipboard.req.target) )
    {
-      lglw->prev.drw = glXGetCurrentDrawable();
-      lglw->prev.ctx = glXGetCurrentContext();
+      // Late reply (timed out / cancelled request). Don't leave the data on our window.
+      if(None != _ev->property)
+         XDeleteProperty(lglw->xdsp, lglw->win.xwnd, _ev->property);
+      return;
+   }
 
-      Dlog_vvv("lglw:lglw_glcontext_push: win.xwnd=%p hidden.xwnd=%p ctx=%p\n",
-               lglw->win.xwnd, lglw->hidden.xwnd, lglw->ctx);
-      if(!glXMakeCurrent(lglw->xdsp, (0 == lglw->win.xwnd) ? lglw->hidden.xwnd : lglw->win.xwnd, lglw->ctx))
+   if(None == _ev->property)
+   {
+      // No owner, or owner can't convert to the requested type
+      loc_clipboard_request_finish(lglw, LGLW_CLIPBOARD_FAILED, NULL, 0u);
+   }
+   else
+   {
+      Atom returnType;
+      int returnFormat;
+      unsigned long numItems, bytesLeft;
+      unsigned char *propertyValue = NULL;
+
+      XGetWindowProperty(lglw->xdsp, lglw->win.xwnd, _ev->property,
+                         0/*offset*/,
+                         0x1FFFFFFF/*length (32bit units)*/,
+                         True/*delete*/,
+                         AnyPropertyType/*req_type*/,
+                         &returnType/*actual_type_return*/,
+                         &returnFormat/*actual_format_return*/,
+                         &numItems/*nitems_return*/,
+                         &bytesLeft/*bytes_after_return*/,
+                         &propertyValue/*prop_return*/);
+
+      if(NULL == propertyValue || None == returnType)
       {
-         Dlog("[---] lglw_glcontext_push: glXMakeCurrent() failed. win.xwnd=%p hidden.xwnd=%p ctx=%p glGetError()=%d\n", lglw->win.xwnd, lglw->hidden.xwnd, lglw->ctx, glGetError());
+         loc_clipboard_request_finish(lglw, LGLW_CLIPBOARD_FAILED, NULL, 0u);
       }
-      // Dlog_vvv("lglw:lglw_glcontext_push: LEAVE\n");
+      else if(lglw->atoms[LGLW_ATOM_INCR] == returnType)
+      {
+         // Owner sends the data in chunks. Deleting the property (see above) requests the first chunk.
+         Dlog_v("lglw:loc_handle_selection_notify: begin INCR transfer (size hint=%lu)\n", (numItems > 0) ? *(unsigned long*)propertyValue : 0ul);
+         lglw->clipboard.req.b_incr = LGLW_TRUE;
+         loc_clipboard_request_restart_timeout(lglw);
+      }
+      else
+      {
+         // (note) Xlib returns format 32 items as (native) longs
+         uint32_t numBytes = (uint32_t) (numItems * ((32 == returnFormat) ? sizeof(long) : (size_t)(returnFormat / 8)));
+         loc_clipboard_request_finish(lglw, LGLW_CLIPBOARD_OK, propertyValue, numBytes);
+      }
+
+      if(NULL != propertyValue)
+         XFree(propertyValue);
    }
 }
 
 
-// ---------------------------------------------------------------------------- lglw_glcontext_rebind
-void lglw_glcontext_rebind(lglw_t _lglw) {
-   LGLW(_lglw);
-   // printf("xxx lglw_glcontext_rebind\n");
-
-   if(NULL != lglw)
-   {
-      Dlog_vvv("lglw:lglw_glcontext_rebind: win.xwnd=%p hidden.xwnd=%p ctx=%p\n",
-               lglw->win.xwnd, lglw->hidden.xwnd, lglw->ctx);
-      (void)glXMakeCurrent(lglw->xdsp, None, NULL);
-      if(!glXMakeCurrent(lglw->xdsp, (0 == lglw->win.xwnd) ? lglw->hidden.xwnd : lglw->win.xwnd, lglw->ctx))
-      {
-         Dlog("[---] lglw_glcontext_rebind: glXMakeCurrent() failed. win.xwnd=%p hidden.xwnd=%p ctx=%p glGetError()=%d\n", lglw->win.xwnd, lglw->hidden.xwnd, lglw->ctx, glGetError());
-      }
-   }
+// ---------------------------------------------------------------------------- loc_clipboard_request_restart_timeout
+static void loc_clipboard_request_restart_timeout(lglw_int_t *lglw) {
+   lglw_timer_remove(lglw, lglw->clipboard.req.timer_id);
+   lglw->clipboard.req.timer_id = loc_timer_add(lglw, loc_time_ns() + LGLW_CLIPBOARD_INCR_TIMEOUT_NS, LGLW_CLIPBOARD_INCR_TIMEOUT_NS,
+                                                &loc_clipboard_request_timeout_cbk, NULL/*userData*/
+                                                );
 }
 
 
-// ---------------------------------------------------------------------------- lglw_glcontext_pop
-void lglw_glcontext_pop(lglw_t _lglw) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_clipboard_receive_chunk
+static void loc_clipboard_receive_chunk(lglw_int_t *lglw) {
+   Atom returnType;
+   int returnFormat;
+   unsigned long numItems, bytesLeft;
+   unsigned char *propertyValue = NULL;
 
-   if(NULL != lglw)
+   XGetWindowProperty(lglw->xdsp, lglw->win.xwnd, lglw->atoms[LGLW_ATOM_CLIPBOARD_RESULT],
+                      0/*offset*/,
+                      0x1FFFFFFF/*length (32bit units)*/,
+                      True/*delete (requests next chunk)*/,
+                      AnyPropertyType/*req_type*/,
+                      &returnType/*actual_type_return*/,
+                      &returnFormat/*actual_format_return*/,
+                      &numItems/*nitems_return*/,
+                      &bytesLeft/*bytes_after_return*/,
+                      &propertyValue/*prop_return*/);
+
+   if(NULL == propertyValue)
    {
-      Dlog_vvv("lglw:lglw_glcontext_pop: prev.drw=%p prev.ctx=%p\n",
-               lglw->prev.drw, lglw->prev.ctx);
-      if(!glXMakeCurrent(lglw->xdsp, lglw->prev.drw, lglw->prev.ctx))
-      {
-         Dlog("[---] lglw_glcontext_pop: glXMakeCurrent() failed. prev.drw=%p ctx=%p glGetError()=%d\n", lglw->prev.drw, lglw->prev.ctx, glGetError());
-      }
+      loc_clipboard_request_finish(lglw, LGLW_CLIPBOARD_FAILED, NULL, 0u);
    }
+   else if(0u == numItems)
+   {
+      // Zero-length chunk terminates the transfer
+      loc_clipboard_request_finish(lglw, LGLW_CLIPBOARD_OK, NULL, 0u);
+   }
+   else
+   {
+      uint32_t numBytes = (uint32_t) (numItems * ((32 == returnFormat) ? sizeof(long) : (size_t)(returnFormat / 8)));
+
+      loc_clipboard_request_restart_timeout(lglw);
+
+      Dlog_vv("lglw:loc_clipboard_receive_chunk: numBytes=%u\n", numBytes);
+      lglw->clipboard.req.cbk(lglw, LGLW_CLIPBOARD_PARTIAL, lglw->clipboard.req.mime_type, propertyValue, numBytes);
+   }
+
+   if(NULL != propertyValue)
+      XFree(propertyValue);
 }
 
 
-// ---------------------------------------------------------------------------- lglw_swap_buffers
-void lglw_swap_buffers(lglw_t _lglw) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_handle_property_notify
+static void loc_handle_property_notify(lglw_int_t *lglw, XPropertyEvent *_ev) {
 
-   if(NULL != lglw)
+   if(PropertyNewValue == _ev->state)
    {
-      if(0 != lglw->win.xwnd)
+      // Incoming INCR chunk
+      if( lglw->clipboard.req.b_incr                                  &&
+          (_ev->window == lglw->win.xwnd)                             &&
+          (_ev->atom == lglw->atoms[LGLW_ATOM_CLIPBOARD_RESULT])
+          )
       {
-         Dlog_vvv("lglw:lglw_swap_buffers: 1\n");
-         glXSwapBuffers(lglw->xdsp, lglw->win.xwnd);
+         loc_clipboard_receive_chunk(lglw);
       }
    }
-}
-
-
-// ---------------------------------------------------------------------------- lglw_swap_interval_set
-typedef void (APIENTRY *PFNWGLEXTSWAPINTERVALPROC) (Display *, GLXDrawable, int);
-void lglw_swap_interval_set(lglw_t _lglw, int32_t _ival) {
-   LGLW(_lglw);
-
-   if(NULL != lglw)
+   else if(PropertyDelete == _ev->state)
    {
-      if(0 != lglw->win.xwnd)
+      // Requestor has consumed the previous outgoing chunk
+      //  (note) on a shared connection, the event is routed to the instance that owns the requestor window (if any),
+      //          which is not necessarily the one that sends the data
+      if(lglw->b_shared_xdsp)
       {
-         Dlog_vv("lglw:lglw_swap_interval_set: 1\n");
-         PFNWGLEXTSWAPINTERVALPROC glXSwapIntervalEXT;
-         glXSwapIntervalEXT = (PFNWGLEXTSWAPINTERVALPROC) glXGetProcAddress((const GLubyte*)"glXSwapIntervalEXT");
-         if(NULL != glXSwapIntervalEXT)
+         Display *xdsp = lglw->xdsp;
+         uint64_t serial = 0u;
+
+         while(NULL != (lglw = loc_shared_instance_next(serial)))
          {
-            Dlog_vv("lglw:lglw_swap_interval_set: 2\n");
-            glXSwapIntervalEXT(lglw->xdsp, lglw->win.xwnd, _ival);
-            lglw->win.swap_interval = _ival;
+            serial = lglw->shared.serial;
+
+            if( (lglw->xdsp == xdsp) && loc_clipboard_send_property_deleted(lglw, _ev) )
+               break;
          }
       }
+      else
+      {
+         loc_clipboard_send_property_deleted(lglw, _ev);
+      }
    }
 }
 
 
-// ---------------------------------------------------------------------------- lglw_swap_interval_get
-int32_t lglw_swap_interval_get(lglw_t _lglw) {
-   LGLW(_lglw);
-   int32_t r = 0;
+// ---------------------------------------------------------------------------- loc_clipboard_send_property_deleted
+//  Send next chunk of the transfer that writes the given property
+//   Return: LGLW_FALSE when the property does not belong to an outgoing transfer of this instance
+static lglw_bool_t loc_clipboard_send_property_deleted(lglw_int_t *lglw, XPropertyEvent *_ev) {
+   uint32_t i;
 
-   if(NULL != lglw)
+   for(i = 0u; i < LGLW_CLIPBOARD_MAX_SEND_TRANSFERS; i++)
    {
-      r = lglw->win.swap_interval;
+      lglw_clipboard_send_t *send = &lglw->clipboard.send[i];
+
+      if( (send->requestor == _ev->window) && (send->property == _ev->atom) )
+      {
+         loc_clipboard_send_next(lglw, send);
+         return LGLW_TRUE;
+      }
    }
 
-   return r;
+   return LGLW_FALSE;
 }
 
 
-// ---------------------------------------------------------------------------- loc_handle_mouseleave
-static void loc_handle_mouseleave(lglw_int_t *lglw) {
-   lglw->focus.state &= ~LGLW_FOCUS_MOUSE;
-
-   if(NULL != lglw->focus.cbk)
-   {
-      lglw->focus.cbk(lglw, lglw->focus.state, LGLW_FOCUS_MOUSE);
-   }
-
-   Dlog_vv("xxx lglw:loc_handle_mouseleave: LEAVE\n");
-}
+// ---------------------------------------------------------------------------- loc_handle_selection_request
+static void loc_handle_selection_request(lglw_int_t *lglw, XSelectionRequestEvent *_ev) {
+   XSelectionEvent cbRes;
 
+   memset(&cbRes, 0, sizeof(cbRes));
+   cbRes.type      = SelectionNotify;
+   cbRes.requestor = _ev->requestor;
+   cbRes.selection = _ev->selection;
+   cbRes.target    = _ev->target;
+   cbRes.time      = _ev->time;
+   cbRes.property  = None;
 
-// ---------------------------------------------------------------------------- loc_handle_mouseenter
-static void loc_handle_mouseenter(lglw_int_t *lglw) {
+   // (note) obsolete clients may pass property=None (use target as property name)
+   Atom property = (None != _ev->property) ? _ev->property : _ev->target;
 
-   lglw->focus.state |= LGLW_FOCUS_MOUSE;
+   lglw_selection_provider_t *provider = (_ev->selection == lglw->atoms[LGLW_ATOM_XDND_SELECTION]) ? &lglw->drag.provider : &lglw->clipboard.provider;
 
-   if(NULL != lglw->focus.cbk)
+   if(NULL == provider->cbk)
    {
-      lglw->focus.cbk(lglw, lglw->focus.state, LGLW_FOCUS_MOUSE);
+      // Not the owner (anymore)
+   }
+   else if(_ev->target == lglw->atoms[LGLW_ATOM_TARGETS])
+   {
+      // List supported types
+      Atom targets[1 + LGLW_CLIPBOARD_MAX_MIME_TYPES];
+      uint32_t numTargets = 0u;
+      uint32_t i;
+
+      targets[numTargets++] = lglw->atoms[LGLW_ATOM_TARGETS];
+      for(i = 0u; i < provider->num_types; i++)
+         targets[numTargets++] = provider->atoms[i];
+
+      XChangeProperty(lglw->xdsp, _ev->requestor, property, XA_ATOM, 32/*format*/, PropModeReplace,
+                      (unsigned char *)targets, (int)numTargets);
+      cbRes.property = property;
    }
-
-   Dlog_vv("xxx lglw:loc_handle_mouseenter: LEAVE\n");
-}
-
-
-// ---------------------------------------------------------------------------- loc_handle_mousebutton
-static void loc_handle_mousebutton(lglw_int_t *lglw, lglw_bool_t _bPressed, uint32_t _button) {
-   if(_bPressed)
-      lglw->mouse.button_state |= _button;
    else
-      lglw->mouse.button_state &= ~_button;
-
-   if(NULL != lglw->mouse.cbk)
    {
-      lglw->mouse.cbk(lglw, lglw->mouse.p.x, lglw->mouse.p.y, lglw->mouse.button_state, _button);
+      uint32_t numBytes;
+      const char *data = loc_selection_provide(lglw, provider, _ev->target, &numBytes);
+
+      if(NULL != data)
+      {
+         if(numBytes <= loc_clipboard_chunk_size(lglw))
+         {
+            XChangeProperty(lglw->xdsp, _ev->requestor, property, _ev->target, 8/*format*/, PropModeReplace,
+                            (const unsigned char *)data, (int)numBytes);
+            cbRes.property = property;
+         }
+         else if(loc_clipboard_send_begin(lglw, _ev->selection, _ev->requestor, property, _ev->target, data, numBytes))
+         {
+            cbRes.property = property;
+         }
+      }
    }
-}
 
+   XSendEvent(lglw->xdsp, _ev->requestor, True, NoEventMask, (XEvent *)&cbRes);
+}
 
-// ---------------------------------------------------------------------------- loc_handle_mousemotion
-static void loc_handle_mousemotion(lglw_int_t *lglw) {
 
-   if(NULL != lglw->mouse.cbk)
+// ---------------------------------------------------------------------------- loc_clipboard_chunk_size
+//  Largest property (in bytes) that can be sent in a single request
+static uint32_t loc_clipboard_chunk_size(lglw_int_t *lglw) {
+   if(0u == lglw->clipboard.incr_chunk_size)
    {
-      lglw->mouse.cbk(lglw, lglw->mouse.p.x, lglw->mouse.p.y, lglw->mouse.button_state, 0u/*changedbuttonstate*/);
-   }
-}
-
+      // (note) both sizes are in 4 byte units
+      long maxReq = XExtendedMaxRequestSize(lglw->xdsp);
+      if(0 == maxReq)
+         maxReq = XMaxRequestSize(lglw->xdsp);
 
-// ---------------------------------------------------------------------------- lglw_mouse_callback_set
-void lglw_mouse_callback_set(lglw_t _lglw, lglw_mouse_fxn_t _cbk) {
-   LGLW(_lglw);
+      uint64_t numBytes = ((uint64_t)maxReq * 4u) - 256u/*request header*/;
+      lglw->clipboard.incr_chunk_size = (numBytes < LGLW_CLIPBOARD_INCR_MAX_CHUNK_SIZE) ? (uint32_t)numBytes : LGLW_CLIPBOARD_INCR_MAX_CHUNK_SIZE;
 
-   if(NULL != lglw)
-   {
-      lglw->mouse.cbk = _cbk;
+      Dlog_v("lglw:loc_clipboard_chunk_size: maxReq=%ld => chunkSize=%u\n", maxReq, lglw->clipboard.incr_chunk_size);
    }
+
+   return lglw->clipboard.incr_chunk_size;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_mouse_callback_set
-void lglw_focus_callback_set(lglw_t _lglw, lglw_focus_fxn_t _cbk) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_clipboard_send_begin
+//  Start outgoing INCR transfer
+//   Return: LGLW_FALSE when all transfer slots are in use
+static lglw_bool_t loc_clipboard_send_begin(lglw_int_t *lglw, Atom _selection, Window _requestor, Atom _property, Atom _type, const char *_data, uint32_t _numBytes) {
+   uint32_t i;
 
-   if(NULL != lglw)
+   for(i = 0u; i < LGLW_CLIPBOARD_MAX_SEND_TRANSFERS; i++)
    {
-      lglw->focus.cbk = _cbk;
+      lglw_clipboard_send_t *send = &lglw->clipboard.send[i];
+
+      if(0 == send->requestor)
+      {
+         lglw_int_t *requestorLGLW = loc_window_map_find(_requestor);
+         long incrSize = (long)_numBytes;
+
+         send->requestor = _requestor;
+         send->selection = _selection;
+         send->property  = _property;
+         send->type      = _type;
+         send->data      = _data;
+         send->num_bytes = _numBytes;
+         send->offset    = 0u;
+
+         // We need to see when the requestor deletes the property
+         //  (note) windows created via this connection already select PropertyChangeMask (see lglw_window_open())
+         //  (note) PropertyNotify events of foreign windows are matched against the send slots (see loc_events_dispatch())
+         send->b_select = (NULL == requestorLGLW) || (requestorLGLW->xdsp != lglw->xdsp);
+         if(send->b_select)
+            XSelectInput(lglw->xdsp, _requestor, PropertyChangeMask);
+
+         send->timer_id = loc_timer_add(lglw, loc_time_ns() + LGLW_CLIPBOARD_INCR_TIMEOUT_NS, LGLW_CLIPBOARD_INCR_TIMEOUT_NS,
+                                        &loc_clipboard_send_timeout_cbk, (void*)send
+                                        );
+
+         XChangeProperty(lglw->xdsp, _requestor, _property, lglw->atoms[LGLW_ATOM_INCR], 32/*format*/, PropModeReplace,
+                         (unsigned char *)&incrSize, 1/*nelements*/);
+
+         Dlog_v("lglw:loc_clipboard_send_begin: requestor=0x%lx numBytes=%u\n", _requestor, _numBytes);
+         return LGLW_TRUE;
+      }
    }
+
+   Dlog("[---] lglw:loc_clipboard_send_begin: too many concurrent transfers\n");
+   return LGLW_FALSE;
 }
 
 
-// ---------------------------------------------------------------------------- loc_handle_key
-static lglw_bool_t loc_handle_key(lglw_int_t *lglw, lglw_bool_t _bPressed, uint32_t _vkey) {
-   lglw_bool_t r = LGLW_FALSE;
+// ---------------------------------------------------------------------------- loc_clipboard_send_next
+static void loc_clipboard_send_next(lglw_int_t *lglw, lglw_clipboard_send_t *_send) {
+   uint32_t numBytes = _send->num_bytes - _send->offset;
+   uint32_t chunkSize = loc_clipboard_chunk_size(lglw);
+
+   if(numBytes > chunkSize)
+      numBytes = chunkSize;
 
-   if(NULL != lglw->keyboard.cbk)
+   // (note) the final zero-length chunk tells the requestor that the transfer is complete
+   XChangeProperty(lglw->xdsp, _send->requestor, _send->property, _send->type, 8/*format*/, PropModeReplace,
+                   (const unsigned char *)(_send->data + _send->offset), (int)numBytes);
+
+   Dlog_vv("lglw:loc_clipboard_send_next: requestor=0x%lx offset=%u numBytes=%u\n", _send->requestor, _send->offset, numBytes);
+
+   if(0u == numBytes)
    {
-      r = lglw->keyboard.cbk(lglw, _vkey, lglw->keyboard.kmod_state, _bPressed);
+      loc_clipboard_send_end(lglw, _send);
    }
+   else
+   {
+      _send->offset += numBytes;
 
-   return r;
+      lglw_timer_remove(lglw, _send->timer_id);
+      _send->timer_id = loc_timer_add(lglw, loc_time_ns() + LGLW_CLIPBOARD_INCR_TIMEOUT_NS, LGLW_CLIPBOARD_INCR_TIMEOUT_NS,
+                                      &loc_clipboard_send_timeout_cbk, (void*)_send
+                                      );
+   }
 }
 
 
-// ---------------------------------------------------------------------------- lglw_keyboard_callback_set
-void lglw_keyboard_callback_set(lglw_t _lglw, lglw_keyboard_fxn_t _cbk) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_clipboard_send_end
+static void loc_clipboard_send_end(lglw_int_t *lglw, lglw_clipboard_send_t *_send) {
+   Dlog_v("lglw:loc_clipboard_send_end: requestor=0x%lx sent=%u/%u\n", _send->requestor, _send->offset, _send->num_bytes);
 
-   if(NULL != lglw)
+   lglw_timer_remove(lglw, _send->timer_id);
+
+   if(_send->b_select)
    {
-      lglw->keyboard.cbk = _cbk;
+      Window requestor = _send->requestor;
+
+      memset(_send, 0, sizeof(lglw_clipboard_send_t));
+
+      // (note) the event mask is per connection, keep it while other transfers write to the same window
+      if(!loc_clipboard_send_is_requestor(lglw, requestor))
+         XSelectInput(lglw->xdsp, requestor, NoEventMask);
+   }
+   else
+   {
+      memset(_send, 0, sizeof(lglw_clipboard_send_t));
    }
 }
 
 
-// ---------------------------------------------------------------------------- lglw_keyboard_get_modifiers
-uint32_t lglw_keyboard_get_modifiers(lglw_t _lglw) {
-   uint32_t r = 0u;
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_clipboard_send_has_requestor
+static lglw_bool_t loc_clipboard_send_has_requestor(lglw_int_t *lglw, Window _requestor) {
+   uint32_t i;
 
-   if(NULL != lglw)
+   for(i = 0u; i < LGLW_CLIPBOARD_MAX_SEND_TRANSFERS; i++)
    {
-      r = lglw->keyboard.kmod_state;
+      if(lglw->clipboard.send[i].requestor == _requestor)
+         return LGLW_TRUE;
    }
 
-   return r;
+   return LGLW_FALSE;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_keyboard_clear_modifiers
-void lglw_keyboard_clear_modifiers(lglw_t _lglw) {
-   LGLW(_lglw);
-
-   if(NULL != lglw)
+// ---------------------------------------------------------------------------- loc_clipboard_send_is_requestor
+//  Check whether any instance that uses the same connection still sends data to the given window
+static lglw_bool_t loc_clipboard_send_is_requestor(lglw_int_t *lglw, Window _requestor) {
+   if(lglw->b_shared_xdsp)
    {
-      lglw->keyboard.kmod_state = 0;
+      Display *xdsp = lglw->xdsp;
+      uint64_t serial = 0u;
+
+      while(NULL != (lglw = loc_shared_instance_next(serial)))
+      {
+         serial = lglw->shared.serial;
+
+         if( (lglw->xdsp == xdsp) && loc_clipboard_send_has_requestor(lglw, _requestor) )
+            return LGLW_TRUE;
+      }
+
+      return LGLW_FALSE;
    }
-}
 
+   return loc_clipboard_send_has_requestor(lglw, _requestor);
+}
 
-// ---------------------------------------------------------------------------- lglw_touchkeyboard_show
-void lglw_touchkeyboard_show(lglw_t _lglw, lglw_bool_t _bEnable) {
-   LGLW(_lglw);
 
-   // (todo) implement me
+// ---------------------------------------------------------------------------- loc_clipboard_send_abort
+//  Abort outgoing transfers of the given selection (None=all transfers)
+static void loc_clipboard_send_abort(lglw_int_t *lglw, Atom _selectionOrNone) {
+   uint32_t i;
 
-   if(NULL != lglw)
+   for(i = 0u; i < LGLW_CLIPBOARD_MAX_SEND_TRANSFERS; i++)
    {
+      lglw_clipboard_send_t *send = &lglw->clipboard.send[i];
+
+      if( (0 != send->requestor) && ((None == _selectionOrNone) || (send->selection == _selectionOrNone)) )
+      {
+         loc_clipboard_send_end(lglw, send);
+      }
    }
 }
 
 
-// ---------------------------------------------------------------------------- lglw_mouse_get_buttons
-uint32_t lglw_mouse_get_buttons(lglw_t _lglw) {
-   uint32_t r = 0u;
+// ---------------------------------------------------------------------------- loc_clipboard_send_timeout_cbk
+static void loc_clipboard_send_timeout_cbk(lglw_t _lglw, uint32_t _timerId, uint32_t _numMissed, void *_userData) {
    LGLW(_lglw);
+   lglw_clipboard_send_t *send = (lglw_clipboard_send_t*)_userData;
+   (void)_timerId;
+   (void)_numMissed;
 
-   if(NULL != lglw)
-   {
-      r = lglw->mouse.button_state;
-   }
-
-   return r;
+   Dlog("[---] lglw:loc_clipboard_send_timeout_cbk: requestor=0x%lx stopped reading\n", send->requestor);
+   loc_clipboard_send_end(lglw, send);
 }
 
 
-// ---------------------------------------------------------------------------- lglw_mouse_grab
-void lglw_mouse_grab(lglw_t _lglw, uint32_t _grabMode) {
+// ---------------------------------------------------------------------------- lglw_events
+void lglw_events(lglw_t _lglw) {
    LGLW(_lglw);
 
    if(NULL != lglw)
    {
-      if(0 != lglw->win.xwnd)
+      loc_event_wakeup_clear(lglw);
+
+      if(lglw->b_shared_xdsp)
       {
-         if(!lglw->mouse.touch.b_enable)
+         // Route events to the instances that own the respective windows
+         loc_events_dispatch(lglw->xdsp);
+      }
+      else if(0 != lglw->win.xwnd)
+      {
+         XEvent xev;
+         int queued = XPending(lglw->xdsp);
+         if(queued > 0)
          {
-            if(lglw->mouse.grab.mode != _grabMode)
-            {
-               lglw_mouse_ungrab(_lglw);
-            }
-
-            int result;
-
-            switch(_grabMode)
-            {
-               default:
-               case LGLW_MOUSE_GRAB_NONE:
-                  break;
-
-               case LGLW_MOUSE_GRAB_CAPTURE:
-                  result = XGrabPointer(lglw->xdsp, lglw->win.xwnd,
-                                        True/*owner_events*/,
-                                        NoEventMask/*event_mask*/,
-                                        GrabModeAsync/*pointer_mode*/,
-                                        GrabModeAsync/*keyboard_mode*/,
-                                        lglw->win.xwnd/*confine_to*/,
-                                        None/*cursor*/,
-                                        CurrentTime/*time*/);
-                  if(GrabSuccess != result)
-                  {
-                     Dlog("lglw: Grab Result: %i\n", result);
-                  }
-                  else
-                  {
-                     lglw->mouse.grab.mode = _grabMode;
-                  }
-                  break;
+            Dlog_vvv("lglw:lglw_events: (events: %i)\n", queued);
+         }
+         // (note) loc_eventProc() may consume additional queued events (see lglw_mouse_motion_coalesce_set())
+         while(queued && (XEventsQueued(lglw->xdsp, QueuedAlready) > 0))
+         {
+            XNextEvent(lglw->xdsp, &xev);
+            loc_eventProc(&xev, lglw);
+            queued--;
+         }
 
-               case LGLW_MOUSE_GRAB_WARP:
-                  result = XGrabPointer(lglw->xdsp, lglw->win.xwnd,
-                                        True/*owner_events*/,
-                                        NoEventMask/*event_mask*/,
-                                        GrabModeAsync/*pointer_mode*/,
-                                        GrabModeAsync/*keyboard_mode*/,
-                                        lglw->win.xwnd/*confine_to*/,
-                                        None/*cursor*/,
-                                        CurrentTime/*time*/);
-                  if(GrabSuccess != result)
-                  {
-                     Dlog("lglw: Grab Result: %i\n", result);
-                  }
-                  else
-                  {
-                     lglw_mouse_cursor_show(_lglw, LGLW_FALSE);
-                     lglw->mouse.grab.p = lglw->mouse.p;
-                     lglw->mouse.grab.last_p = lglw->mouse.p;
-                     lglw->mouse.grab.mode = _grabMode;
-                  }
-                  break;
-            }
+         // Events that were read into the Xlib queue while processing (e.g. during XSync()) won't
+         //  make the connection fd readable again
+         if(XEventsQueued(lglw->xdsp, QueuedAlready) > 0)
+         {
+            loc_event_wakeup(lglw);
+         }
+      }
+      else if(NULL != lglw->xdsp)
+      {
+         // Discard events that arrive while no window is open (keeps the event fd from signalling)
+         XEvent xev;
+         int queued = XPending(lglw->xdsp);
+         while(queued)
+         {
+            XNextEvent(lglw->xdsp, &xev);
+            queued--;
          }
       }
+
+      loc_process_timer(lglw);
    }
 }
 
 
-// ---------------------------------------------------------------------------- lglw_mouse_ungrab
-void lglw_mouse_ungrab(lglw_t _lglw) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_events_dispatch
+//  Process all available events of a (shared) connection and route them to the instances that own the windows
+static void loc_events_dispatch(Display *_xdsp) {
+   XEvent xev;
+   int queued = XPending(_xdsp);
 
-   if(NULL != lglw)
+   while(queued && (XEventsQueued(_xdsp, QueuedAlready) > 0))
    {
-      if(0 != lglw->win.xwnd)
+      lglw_int_t *lglw;
+
+      XNextEvent(_xdsp, &xev);
+      queued--;
+
+      if(GenericEvent == xev.type)
       {
-         if(!lglw->mouse.touch.b_enable)
-         {
-            switch(lglw->mouse.grab.mode)
-            {
-               default:
-               case LGLW_MOUSE_GRAB_NONE:
-                  break;
+         // (note) GenericEvent has no window field (XInput 2 raw events are selected by the relative grab owner)
+         lglw = loc_mouse_relative_owner;
+         if(NULL != lglw && lglw->xdsp != _xdsp)
+            lglw = NULL;
+      }
+      else
+      {
+         lglw = loc_window_map_find(xev.xany.window);
 
-               case LGLW_MOUSE_GRAB_CAPTURE:
-                  XUngrabPointer(lglw->xdsp, CurrentTime);
-                  lglw->mouse.grab.mode = LGLW_MOUSE_GRAB_NONE;
-                  break;
+         if( (NULL == lglw) && __atomic_load_n(&loc_window_map.b_overflow, __ATOMIC_ACQUIRE) )
+            lglw = loc_shared_instance_from_property(_xdsp, xev.xany.window);
+      }
 
-               case LGLW_MOUSE_GRAB_WARP:
-                  XUngrabPointer(lglw->xdsp, CurrentTime);
-                  lglw->mouse.grab.mode = LGLW_MOUSE_GRAB_NONE;
-                  lglw->mouse.grab.b_queue_warp = LGLW_TRUE;
-                  lglw_mouse_cursor_show(_lglw, LGLW_TRUE);
-                  break;
+      if(NULL != lglw && 0 != lglw->win.xwnd)
+      {
+         loc_eventProc(&xev, lglw);
+      }
+      else if( (NULL == lglw) && (PropertyNotify == xev.type) )
+      {
+         // Foreign window that receives an outgoing INCR transfer (see loc_clipboard_send_begin())
+         uint64_t serial = 0u;
+
+         while(NULL != (lglw = loc_shared_instance_next(serial)))
+         {
+            serial = lglw->shared.serial;
+
+            if(lglw->xdsp == _xdsp)
+            {
+               // (note) searches the transfers of all instances that use this connection
+               loc_handle_property_notify(lglw, &xev.xproperty);
+               break;
             }
          }
       }
+      else
+      {
+         Dlog_vvv("lglw:loc_events_dispatch: discard event type=%d window=0x%lx\n", xev.type, xev.xany.window);
+      }
    }
 }
 
 
-// ---------------------------------------------------------------------------- lglw_mouse_warp
-void lglw_mouse_warp(lglw_t _lglw, int32_t _x, int32_t _y) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- lglw_events_shared
+//  (note) callbacks may call lglw_exit() on any instance, so the next instance is looked up again after each
+//          dispatch / timer pass (instead of iterating a snapshot of the instance list)
+void lglw_events_shared(void) {
+   lglw_display_cache_t *dispatched[LGLW_MAX_SHARED_DISPLAYS];
+   uint32_t numDispatched = 0u;
+   uint64_t serial;
+   lglw_int_t *lglw;
 
-   if(NULL != lglw)
+   // Dispatch events of each shared connection once
+   serial = 0u;
+   while( (numDispatched < LGLW_MAX_SHARED_DISPLAYS) && (NULL != (lglw = loc_shared_instance_next(serial))) )
    {
-      if(0 != lglw->win.xwnd)
+      lglw_display_cache_t *dcache = lglw->dcache;
+      uint32_t i;
+
+      serial = lglw->shared.serial;
+
+      for(i = 0u; i < numDispatched; i++)
       {
-         XWarpPointer(lglw->xdsp,
-                      None/*src_w*/,
-                      lglw->win.xwnd/*dest_w*/,
-                      0/*src_x*/,
-                      0/*src_y*/,
-                      0/*src_width*/,
-                      0/*src_height*/,
-                      _x/*dest_x*/,
-                      _y/*dest_y*/);
+         if(dispatched[i] == dcache)
+         {
+            dcache = NULL;
+            break;
+         }
+      }
+
+      if(NULL != dcache)
+      {
+         // Keep the connection open even when a callback exits the last instance that uses it
+         pthread_mutex_lock(&loc_display_cache.mtx);
+         dcache->ref_count++;
+         pthread_mutex_unlock(&loc_display_cache.mtx);
+
+         // (note) the reference is held until the end of the pass. a freed entry's address could otherwise be
+         //         reused by a new entry (created by a callback), whose connection would then be skipped
+         dispatched[numDispatched++] = dcache;
+         loc_events_dispatch(dcache->shared_xdsp);
       }
    }
-}
 
+   // Process due timers
+   serial = 0u;
+   while(NULL != (lglw = loc_shared_instance_next(serial)))
+   {
+      serial = lglw->shared.serial;
+      loc_event_wakeup_clear(lglw);
+      loc_process_timer(lglw);
+   }
 
-// ---------------------------------------------------------------------------- loc_handle_queued_mouse_warp
-static void loc_handle_queued_mouse_warp(lglw_int_t *lglw) {
-   if(lglw->mouse.grab.b_queue_warp)
+   while(numDispatched > 0u)
    {
-      lglw->mouse.grab.b_queue_warp = LGLW_FALSE;
-      lglw_mouse_warp(lglw, lglw->mouse.grab.p.x, lglw->mouse.grab.p.y);
-      lglw->mouse.grab.last_p = lglw->mouse.grab.p;
+      loc_display_cache_unref(dispatched[--numDispatched]);
    }
 }
 
 
-// ---------------------------------------------------------------------------- lglw_mouse_cursor_show
-void lglw_mouse_cursor_show (lglw_t _lglw, lglw_bool_t _bShow) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_shared_instance_add
+static void loc_shared_instance_add(lglw_int_t *lglw) {
+   pthread_mutex_lock(&loc_shared_instances.mtx);
 
-   if(NULL != lglw)
-   {
-      if(LGLW_FALSE == _bShow)
-      {
-         Pixmap noPxm;
-         Cursor noCursor;
-         XColor black, dummy;
-         static char pxmNoData[] = {0, 0, 0, 0, 0, 0, 0, 0};
+   lglw->shared.serial = loc_shared_instances.next_serial++;
+   lglw->shared.next   = NULL;
+   lglw->shared.prev   = loc_shared_instances.last;
 
-         XAllocNamedColor(lglw->xdsp, lglw->cmap, "black", &black, &dummy);
-         noPxm = XCreateBitmapFromData(lglw->xdsp, lglw->win.xwnd, pxmNoData, 8, 8);
-         noCursor = XCreatePixmapCursor(lglw->xdsp, noPxm, noPxm, &black, &black, 0, 0);
+   if(NULL != loc_shared_instances.last)
+      loc_shared_instances.last->shared.next = lglw;
+   else
+      loc_shared_instances.first = lglw;
 
-         XDefineCursor(lglw->xdsp, lglw->win.xwnd, noCursor);
-         XFreeCursor(lglw->xdsp, noCursor);
-         if(noPxm != None)
-         {
-            XFreePixmap(lglw->xdsp, noPxm);
-         }
-      }
-      else
-      {
-         XUndefineCursor(lglw->xdsp, lglw->win.xwnd);
-      }
-   }
+   loc_shared_instances.last = lglw;
+
+   pthread_mutex_unlock(&loc_shared_instances.mtx);
 }
 
 
-// ---------------------------------------------------------------------------- lglw_timer_start
-void lglw_timer_start(lglw_t _lglw, uint32_t _millisec) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_shared_instance_remove
+static void loc_shared_instance_remove(lglw_int_t *lglw) {
+   pthread_mutex_lock(&loc_shared_instances.mtx);
 
-   if(NULL != lglw)
-   {
-      Dlog_v("lglw:lglw_timer_start: interval=%u\n", _millisec);
-      lglw->timer.interval_ms = _millisec;
-      lglw->timer.b_running   = LGLW_TRUE;
-   }
-}
+   if(NULL != lglw->shared.prev)
+      lglw->shared.prev->shared.next = lglw->shared.next;
+   else
+      loc_shared_instances.first = lglw->shared.next;
 
+   if(NULL != lglw->shared.next)
+      lglw->shared.next->shared.prev = lglw->shared.prev;
+   else
+      loc_shared_instances.last = lglw->shared.prev;
 
-// ---------------------------------------------------------------------------- lglw_timer_stop
-void lglw_timer_stop(lglw_t _lglw) {
-   LGLW(_lglw);
+   lglw->shared.next = NULL;
+   lglw->shared.prev = NULL;
 
-   if(NULL != lglw)
-   {
-      Dlog_v("lglw:lglw_timer_stop\n");
-      lglw->timer.b_running = LGLW_FALSE;
-   }
+   pthread_mutex_unlock(&loc_shared_instances.mtx);
 }
 
 
-// ---------------------------------------------------------------------------- lglw_timer_callback_set
-void lglw_timer_callback_set(lglw_t _lglw, lglw_timer_fxn_t _cbk) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_shared_instance_next
+//  Find first registered instance whose serial is greater than the given one (0=first instance)
+//   (note) must be called from the UI thread (i.e. the returned instance stays valid until a callback runs)
+static lglw_int_t *loc_shared_instance_next(uint64_t _serial) {
+   lglw_int_t *r;
 
-   if(NULL != lglw)
+   pthread_mutex_lock(&loc_shared_instances.mtx);
+
+   for(r = loc_shared_instances.first; NULL != r; r = r->shared.next)
    {
-      lglw->timer.cbk = _cbk;
+      if(r->shared.serial > _serial)
+         break;
    }
+
+   pthread_mutex_unlock(&loc_shared_instances.mtx);
+
+   return r;
 }
 
 
-// ---------------------------------------------------------------------------- loc_process_timer()
-static void loc_process_timer(lglw_int_t *lglw) {
-   if(lglw->timer.b_running)
+// ---------------------------------------------------------------------------- loc_shared_instance_from_property
+//  Look up the instance that owns a window via its _lglw property (fallback when the window map is full)
+//   (note) server round trip. the pointer is only returned when it refers to a registered instance that uses the given connection.
+static lglw_int_t *loc_shared_instance_from_property(Display *_xdsp, Window _xwnd) {
+   lglw_int_t *p = loc_getProperty(_xdsp, _xwnd, loc_display_atom_get(_xdsp, LGLW_ATOM_LGLW));
+   lglw_int_t *r = NULL;
+
+   if(NULL != p)
    {
-      uint32_t ms = loc_millisec_delta(lglw);
+      pthread_mutex_lock(&loc_shared_instances.mtx);
 
-      if( (ms - lglw->timer.last_ms) >= lglw->timer.interval_ms )
+      for(r = loc_shared_instances.first; NULL != r; r = r->shared.next)
       {
-         lglw->timer.last_ms = ms;
-
-         if(NULL != lglw->timer.cbk)
-         {
-            Dlog_vvv("lglw: invoke timer callback\n");
-            lglw->timer.cbk(lglw);
-         }
+         if( (r == p) && (r->xdsp == _xdsp) )
+            break;
       }
+
+      pthread_mutex_unlock(&loc_shared_instances.mtx);
    }
+
+   return r;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_time_get_millisec
-uint32_t lglw_time_get_millisec(lglw_t _lglw) {
-   uint32_t r = 0u;
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_window_map_hash
+static uint32_t loc_window_map_hash(Window _xwnd) {
+   uint32_t h = (uint32_t)(_xwnd ^ (_xwnd >> 21));
+   return (h * 0x9E3779B1u) & (LGLW_WINDOW_MAP_SIZE - 1u);
+}
 
-   if(NULL != lglw)
+
+// ---------------------------------------------------------------------------- loc_window_map_add
+//  Return: LGLW_FALSE when the map is full (the caller must then store the instance pointer in the window's _lglw property)
+static lglw_bool_t loc_window_map_add(Window _xwnd, lglw_int_t *lglw) {
+   uint32_t idx = loc_window_map_hash(_xwnd);
+   uint32_t i;
+   int32_t freeIdx = -1;
+
+   pthread_mutex_lock(&loc_window_map.mtx);
+
+   for(i = 0u; i < LGLW_WINDOW_MAP_SIZE; i++, idx = (idx + 1u) & (LGLW_WINDOW_MAP_SIZE - 1u))
    {
-      r = loc_millisec_delta(lglw);
+      Window xwnd = loc_window_map.entries[idx].xwnd;
+
+      if(xwnd == _xwnd)
+      {
+         freeIdx = (int32_t)idx;  // replace
+         break;
+      }
+      else if(0 == xwnd)
+      {
+         if(-1 == freeIdx)
+            freeIdx = (int32_t)idx;
+         break;
+      }
+      else if( (LGLW_WINDOW_MAP_TOMBSTONE == xwnd) && (-1 == freeIdx) )
+      {
+         freeIdx = (int32_t)idx;  // reuse, unless the key exists further down the probe sequence
+      }
    }
-   
-   return r;
-}
 
+   if(-1 != freeIdx)
+   {
+      // (note) publish value before key (see loc_window_map_find())
+      __atomic_store_n(&loc_window_map.entries[freeIdx].lglw, lglw,  __ATOMIC_RELEASE);
+      __atomic_store_n(&loc_window_map.entries[freeIdx].xwnd, _xwnd, __ATOMIC_RELEASE);
+   }
+   else
+   {
+      Dlog("[---] lglw:loc_window_map_add: map is full (xwnd=0x%lx), falling back to window property lookups\n", _xwnd);
+      __atomic_store_n(&loc_window_map.b_overflow, LGLW_TRUE, __ATOMIC_RELEASE);
+   }
 
-// ---------------------------------------------------------------------------- loc_enable_dropfiles
-static void loc_enable_dropfiles(lglw_int_t *lglw, lglw_bool_t _bEnable) {
+   pthread_mutex_unlock(&loc_window_map.mtx);
 
-   // (todo) implement me
+   return (-1 != freeIdx);
 }
 
 
-// ---------------------------------------------------------------------------- lglw_dropfiles_callback_set
-void lglw_dropfiles_callback_set(lglw_t _lglw, lglw_dropfiles_fxn_t _cbk) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_window_map_remove
+//  Remove window, unless it has been re-assigned to another instance in the meantime
+//   A tombstone that ends a probe cluster (next slot is free) is turned back into a free slot, along with
+//   the tombstones that precede it. This is safe for concurrent lookups: no probe sequence of a key that
+//   is still in the map can pass a free slot, so it can't pass the tombstones in front of it either.
+static void loc_window_map_remove(Window _xwnd, lglw_int_t *lglw) {
+   uint32_t idx = loc_window_map_hash(_xwnd);
+   uint32_t i;
 
-   if(NULL != _lglw)
+   pthread_mutex_lock(&loc_window_map.mtx);
+
+   for(i = 0u; i < LGLW_WINDOW_MAP_SIZE; i++, idx = (idx + 1u) & (LGLW_WINDOW_MAP_SIZE - 1u))
    {
-      lglw->dropfiles.cbk = _cbk;
+      Window xwnd = loc_window_map.entries[idx].xwnd;
 
-      loc_enable_dropfiles(lglw, (NULL != _cbk));
+      if(xwnd == _xwnd)
+      {
+         if(loc_window_map.entries[idx].lglw == lglw)
+         {
+            __atomic_store_n(&loc_window_map.entries[idx].xwnd, LGLW_WINDOW_MAP_TOMBSTONE, __ATOMIC_RELEASE);
+            __atomic_store_n(&loc_window_map.entries[idx].lglw, NULL, __ATOMIC_RELEASE);
+
+            // Reclaim trailing tombstones
+            if(0 == loc_window_map.entries[(idx + 1u) & (LGLW_WINDOW_MAP_SIZE - 1u)].xwnd)
+            {
+               for(i = 0u; i < LGLW_WINDOW_MAP_SIZE; i++, idx = (idx - 1u) & (LGLW_WINDOW_MAP_SIZE - 1u))
+               {
+                  if(LGLW_WINDOW_MAP_TOMBSTONE != loc_window_map.entries[idx].xwnd)
+                     break;
+
+                  __atomic_store_n(&loc_window_map.entries[idx].xwnd, 0, __ATOMIC_RELEASE);
+               }
+            }
+         }
+         break;
+      }
+      else if(0 == xwnd)
+      {
+         break;
+      }
    }
+
+   pthread_mutex_unlock(&loc_window_map.mtx);
 }
 
 
-// ---------------------------------------------------------------------------- lglw_touchinput_set
-void lglw_touchinput_set(lglw_t _lglw, lglw_bool_t _bEnable) {
-   LGLW(_lglw);
+// ---------------------------------------------------------------------------- loc_window_map_find
+//  Lock-free lookup (called for every event)
+//   (note) a slot is only reset to 0 (free) when no key in the map has a probe sequence that passes it
+//           (see loc_window_map_remove()), so a concurrent remove / add can't cut off the probe sequence
+static lglw_int_t *loc_window_map_find(Window _xwnd) {
+   lglw_int_t *r = NULL;
+   uint32_t idx = loc_window_map_hash(_xwnd);
+   uint32_t i;
 
-   if(NULL != _lglw)
+   if(0 == _xwnd || LGLW_WINDOW_MAP_TOMBSTONE == _xwnd)
+      return NULL;
+
+   for(i = 0u; i < LGLW_WINDOW_MAP_SIZE; i++, idx = (idx + 1u) & (LGLW_WINDOW_MAP_SIZE - 1u))
    {
-      lglw->mouse.touch.b_enable = _bEnable;
-      lglw->mouse.touch.b_update_queued = LGLW_TRUE;
-   }
-}
+      Window xwnd = __atomic_load_n(&loc_window_map.entries[idx].xwnd, __ATOMIC_ACQUIRE);
 
+      if(xwnd == _xwnd)
+      {
+         r = __atomic_load_n(&loc_window_map.entries[idx].lglw, __ATOMIC_ACQUIRE);
 
-// ---------------------------------------------------------------------------- lglw_touchinput_get
-lglw_bool_t lglw_touchinput_get(lglw_t _lglw) {
-   lglw_bool_t r = LGLW_FALSE;
-   LGLW(_lglw);
+         // Slot may have been removed / re-assigned while the value was read
+         if(__atomic_load_n(&loc_window_map.entries[idx].xwnd, __ATOMIC_ACQUIRE) != _xwnd)
+            r = NULL;
 
-   if(NULL != _lglw)
-   {
-      r = lglw->mouse.touch.b_enable;
+         break;
+      }
+      else if(0 == xwnd)
+      {
+         break;
+      }
    }
 
    return r;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_clipboard_text_set
-void lglw_clipboard_text_set(lglw_t _lglw, const uint32_t _numChars, const char *_text) {
+// ---------------------------------------------------------------------------- lglw_events_wait
+lglw_bool_t lglw_events_wait(lglw_t _lglw, uint64_t _timeoutNS) {
+   lglw_bool_t r = LGLW_FALSE;
    LGLW(_lglw);
-   (void)_numChars;
 
-   if(NULL != _text)
+   if(NULL != lglw)
    {
-      if(NULL != _lglw)
+      // Don't sleep past the next timer tick
+      uint64_t timeoutNS = loc_timer_timeout_ns(lglw);
+      if(_timeoutNS < timeoutNS)
+         timeoutNS = _timeoutNS;
+
+      if(NULL != lglw->xdsp)
       {
-         if(0 != lglw->win.xwnd)
+         // Send pending requests before going to sleep (replies / events may depend on them)
+         XFlush(lglw->xdsp);
+
+         if(XEventsQueued(lglw->xdsp, QueuedAlready) > 0)
          {
-            uint32_t numChars = (0u == _numChars) ? ((uint32_t)strlen(_text)+1u) : _numChars;
+            // (note) events have already been read into the Xlib queue, the connection fd won't signal them
+            r = LGLW_TRUE;
+            timeoutNS = 0u;
+         }
+      }
 
-            if(numChars > 0u)
-            {
-               lglw->clipboard.numChars = numChars;
-               lglw->clipboard.data = malloc(numChars+1);
+      if(timeoutNS > 0u)
+      {
+         struct pollfd pfd;
+         struct timespec ts;
+         int numReady;
 
-               uint32_t i;
-               for(i = 0u; i < numChars; i++)
-               {
-                  lglw->clipboard.data[i] = _text[i];
-               }
-               lglw->clipboard.data[numChars - 1] = 0;
+         pfd.fd      = lglw->event.fd;
+         pfd.events  = POLLIN;
+         pfd.revents = 0;
 
-               Dlog("xxx lglw_clipboard_text_set(%i): %s\n", lglw->clipboard.numChars, lglw->clipboard.data);
+         ts.tv_sec  = (time_t)(timeoutNS / 1000000000u);
+         ts.tv_nsec = (long)(timeoutNS % 1000000000u);
+
+         Dlog_vvv("lglw:lglw_events_wait: timeoutNS=%llu\n", (unsigned long long)timeoutNS);
+
+         numReady = ppoll(&pfd, 1, (LGLW_EVENTS_WAIT_INFINITE == timeoutNS) ? NULL : &ts, NULL/*sigmask*/);
 
-               Atom clipboard = XInternAtom(lglw->xdsp, "CLIPBOARD", False);
-               XSetSelectionOwner(lglw->xdsp, clipboard, lglw->win.xwnd, CurrentTime);
-               XSync(lglw->xdsp, False);
+         if(numReady < 0)
+         {
+            if(EINTR != errno)
+            {
+               Dlog("[---] lglw:lglw_events_wait: ppoll() failed. errno=%d\n", errno);
             }
          }
+         else
+         {
+            r = (numReady > 0);
+         }
       }
-   }
-}
 
+      lglw_events(_lglw);
+   }
 
-// ---------------------------------------------------------------------------- loc_is_clipboard_event
-static Bool loc_is_clipboard_event(Display *_display, XEvent *_xevent, XPointer _xarg) {
-   return _xevent->type == SelectionNotify;
+   return r;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_clipboard_text_get
-void lglw_clipboard_text_get(lglw_t _lglw, uint32_t _maxChars, uint32_t *_retNumChars, char *_retText) {
+// ---------------------------------------------------------------------------- lglw_event_fd_get
+int lglw_event_fd_get(lglw_t _lglw) {
+   int r = -1;
    LGLW(_lglw);
 
-   if(NULL != _retNumChars)
-      *_retNumChars = 0u;
-
-   if(NULL != _retText)
-      *_retText = 0;
-
-   if(_maxChars > 0u)
+   if(NULL != lglw)
    {
-      if(NULL != _lglw)
-      {
-         if(0 != lglw->win.xwnd)
-         {
-            Window owner;
-            XEvent xev;
-            XSelectionEvent *cbReq;
-            Atom clipboard = XInternAtom(lglw->xdsp, "CLIPBOARD", False);
-            Atom utf8 = XInternAtom(lglw->xdsp, "UTF8_STRING", False);
-            Atom target = XInternAtom(lglw->xdsp, "_clipboard_result", False);
-
-            owner = XGetSelectionOwner(lglw->xdsp, clipboard);
-            if(owner == None)
-            {
-               Dlog("xxx lglw_clipboard_text_get: No Window can provide a clipboard result\n");
-               return;
-            }
-
-            if(owner == lglw->win.xwnd)
-            {
-               Dlog("xxx lglw_clipboard_text_get: We are the owner of the clipboard, skip X interactions\n");
+      r = lglw->event.fd;
+   }
 
-               uint32_t i = 0u;
-               for(; i < _maxChars; i++)
-               {
-                  _retText[i] = lglw->clipboard.data[i];
-                  if(0 == _retText[i])
-                     break;
-               }
-               _retText[_maxChars - 1u] = 0;
+   return r;
+}
 
-               if(NULL != _retNumChars)
-                  *_retNumChars = i;
 
-               Dlog("xxx lglw_clipboard_text_get: (result on next line)\n%s\n", _retText);
-               return;
-            }
+// ---------------------------------------------------------------------------- loc_event_queue_alloc
+static lglw_event_t *loc_event_queue_alloc(lglw_int_t *lglw, uint32_t _type) {
+   lglw_event_t *r = NULL;
 
-            XConvertSelection(lglw->xdsp, clipboard, utf8, target, lglw->win.xwnd, CurrentTime);
-            XIfEvent(lglw->xdsp, &xev, &loc_is_clipboard_event, None);
+   if( (lglw->queue.write_idx - lglw->queue.read_idx) < LGLW_EVENT_QUEUE_SIZE )
+   {
+      r = &lglw->queue.events[lglw->queue.write_idx & (LGLW_EVENT_QUEUE_SIZE - 1u)];
+      r->type        = _type;
+      r->server_time = lglw->event.server_time;
+      r->recv_ns     = lglw->event.recv_ns;
+      lglw->queue.write_idx++;
+   }
+   else
+   {
+      lglw->queue.num_dropped++;
+      Dlog_v("lglw:loc_event_queue_alloc: queue overflow, event type=%u dropped (total=%u)\n", _type, lglw->queue.num_dropped);
+   }
 
-            cbReq = (XSelectionEvent*)&xev;
-            if(None == cbReq->property)
-            {
-               Dlog("xxx lglw_clipboard_text_get: Clipboard was not converted to UTF-8 string\n");
-               return;
-            }
+   return r;
+}
 
-            Atom returnType;
-            int returnFormat;
-            unsigned long size, returnSize, bytesLeft;
-            unsigned char *propertyValue = NULL;
 
-            XGetWindowProperty(lglw->xdsp, lglw->win.xwnd, target,
-                               0/*offset*/,
-                               0/*length*/,
-                               False/*delete*/,
-                               AnyPropertyType/*req_type*/,
-                               &returnType/*actual_type_return*/,
-                               &returnFormat/*actual_format_return*/,
-                               &returnSize/*nitems_return*/,
-                               &size/*bytes_after_return*/,
-                               &propertyValue/*prop_return*/);
-            XFree(propertyValue);
+// ---------------------------------------------------------------------------- lglw_events_queue_enable
+void lglw_events_queue_enable(lglw_t _lglw, lglw_bool_t _bEnable) {
+   LGLW(_lglw);
 
-            if(utf8 != returnType)
-            {
-               Dlog("xxx lglw_clipboard_text_get: Clipboard result is not a UTF-8 string\n");
-               return;
-            }
+   if(NULL != lglw)
+   {
+      lglw->queue.b_enable  = _bEnable;
+      lglw->queue.read_idx  = 0u;
+      lglw->queue.write_idx = 0u;
+   }
+}
 
-            if(8u != returnFormat)
-            {
-               Dlog("xxx lglw_clipboard_text_get: Clipboard format is not a char array\n");
-               return;
-            }
 
-            if(_maxChars < size)
-               size = _maxChars;
-            size = 1 + ((size - 1) / 4);
+// ---------------------------------------------------------------------------- lglw_events_poll
+uint32_t lglw_events_poll(lglw_t _lglw, lglw_event_t *_retEvents, uint32_t _maxEvents) {
+   uint32_t r = 0u;
+   LGLW(_lglw);
 
-            // TODO: Even with the largest current use-case, multiple calls aren't necessary. do it anyway just in case
-            XGetWindowProperty(lglw->xdsp, lglw->win.xwnd, target,
-                               0/*offset*/,
-                               size/*length*/,
-                               True/*delete*/,
-                               AnyPropertyType/*req_type*/,
-                               &returnType/*actual_type_return*/,
-                               &returnFormat/*actual_format_return*/,
-                               &returnSize/*nitems_return*/,
-                               &bytesLeft/*bytes_after_return*/,
-                               &propertyValue/*prop_return*/);
+   if(NULL != lglw && NULL != _retEvents)
+   {
+      uint32_t numAvail = (lglw->queue.write_idx - lglw->queue.read_idx);
+      r = (numAvail < _maxEvents) ? numAvail : _maxEvents;
 
-            if(returnSize == 0)
-            {
-               Dlog("xxx lglw_clipboard_text_get: No Clipboard result after final request\n");
-               return;
-            }
+      if(r > 0u)
+      {
+         // Copy in (at most) two contiguous chunks
+         uint32_t readOff  = lglw->queue.read_idx & (LGLW_EVENT_QUEUE_SIZE - 1u);
+         uint32_t numFirst = LGLW_EVENT_QUEUE_SIZE - readOff;
+         if(numFirst > r)
+            numFirst = r;
 
-            uint32_t i = 0u;
-            for(; i < _maxChars; i++)
-            {
-               _retText[i] = propertyValue[i];
-               if(0 == _retText[i])
-                  break;
-            }
-            _retText[_maxChars - 1u] = 0;
+         memcpy(_retEvents, &lglw->queue.events[readOff], numFirst * sizeof(lglw_event_t));
 
-            if(NULL != _retNumChars)
-               *_retNumChars = i;
+         if(r > numFirst)
+            memcpy(_retEvents + numFirst, &lglw->queue.events[0], (r - numFirst) * sizeof(lglw_event_t));
 
-            Dlog("xxx lglw_clipboard_text_get: (result on next line)\n%s\n", _retText);
-            XFree(propertyValue);
-         }
+         lglw->queue.read_idx += r;
       }
    }
+
+   return r;
 }
 
 
-// ---------------------------------------------------------------------------- lglw_events
-void lglw_events(lglw_t _lglw) {
+// ---------------------------------------------------------------------------- lglw_event_time_get
+void lglw_event_time_get(lglw_t _lglw, uint32_t *_retServerTime, uint64_t *_retRecvNS) {
    LGLW(_lglw);
 
    if(NULL != lglw)
    {
-      if(0 != lglw->win.xwnd)
-      {
-         XEvent xev;
-         int queued = XPending(lglw->xdsp);
-         if(queued > 0)
-         {
-            Dlog_vvv("lglw:lglw_events: (events: %i)\n", queued);
-         }
-         while(queued)
-         {
-            XNextEvent(lglw->xdsp, &xev);
-            loc_eventProc(&xev, lglw);
-            queued--;
-         }
+      if(NULL != _retServerTime)
+         *_retServerTime = lglw->event.server_time;
 
-         loc_process_timer(lglw);
-      }
+      if(NULL != _retRecvNS)
+         *_retRecvNS = lglw->event.recv_ns;
    }
 }
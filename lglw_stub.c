@@ -808,3 +808,318 @@ void lglw_clipboard_text_get(lglw_t _lglw, uint32_t _maxChars, uint32_t *_retNum
       }
    }
 }
+
+
+// ---------------------------------------------------------------------------- Linux only API
+//  (note) the functions below are not supported on this platform (no-op / failure return values)
+
+
+// ---------------------------------------------------------------------------- lglw_init_ex
+lglw_t lglw_init_ex(int32_t _w, int32_t _h, uint32_t _flags) {
+   (void)_flags;
+
+   return lglw_init(_w, _h);
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_share_group_set
+void lglw_glcontext_share_group_set(lglw_bool_t _bEnable) {
+   (void)_bEnable;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_share_group_get
+lglw_bool_t lglw_glcontext_share_group_get(lglw_t _lglw) {
+   (void)_lglw;
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_stats_get
+void lglw_glcontext_stats_get(lglw_t _lglw, uint32_t *_retNumBinds, uint32_t *_retNumBindsSkipped) {
+   (void)_lglw;
+
+   if(NULL != _retNumBinds)
+      *_retNumBinds = 0u;
+
+   if(NULL != _retNumBindsSkipped)
+      *_retNumBindsSkipped = 0u;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_worker_create
+lglw_glworker_t lglw_glcontext_worker_create(lglw_t _lglw) {
+   (void)_lglw;
+
+   return NULL;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_worker_destroy
+void lglw_glcontext_worker_destroy(lglw_glworker_t _worker) {
+   (void)_worker;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_worker_bind
+lglw_bool_t lglw_glcontext_worker_bind(lglw_glworker_t _worker) {
+   (void)_worker;
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glcontext_worker_unbind
+void lglw_glcontext_worker_unbind(lglw_glworker_t _worker) {
+   (void)_worker;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glfence_insert
+lglw_glfence_t lglw_glfence_insert(void) {
+   return NULL;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glfence_wait
+lglw_bool_t lglw_glfence_wait(lglw_glfence_t _fence, uint64_t _timeoutNS) {
+   (void)_fence;
+   (void)_timeoutNS;
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glfence_wait_gpu
+void lglw_glfence_wait_gpu(lglw_glfence_t _fence) {
+   (void)_fence;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_glfence_delete
+void lglw_glfence_delete(lglw_glfence_t _fence) {
+   (void)_fence;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_frame_callback_set
+void lglw_frame_callback_set(lglw_t _lglw, lglw_frame_fxn_t _cbk) {
+   (void)_lglw;
+   (void)_cbk;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_frame_period_get
+uint64_t lglw_frame_period_get(lglw_t _lglw) {
+   (void)_lglw;
+
+   return 0u;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_relative_callback_set
+void lglw_mouse_relative_callback_set(lglw_t _lglw, lglw_mouse_relative_fxn_t _cbk) {
+   (void)_lglw;
+   (void)_cbk;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_keyboard_repeat_set
+void lglw_keyboard_repeat_set(lglw_t _lglw, lglw_bool_t _bEnable) {
+   (void)_lglw;
+   (void)_bEnable;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_keyboard_get_repeat_count
+uint32_t lglw_keyboard_get_repeat_count(lglw_t _lglw) {
+   (void)_lglw;
+
+   return 0u;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_cursor_standard_get
+lglw_cursor_t lglw_cursor_standard_get(lglw_t _lglw, uint32_t _shape) {
+   (void)_lglw;
+   (void)_shape;
+
+   return NULL;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_cursor_create_argb
+lglw_cursor_t lglw_cursor_create_argb(lglw_t _lglw, uint32_t _w, uint32_t _h, int32_t _hotX, int32_t _hotY, const uint32_t *_argb) {
+   (void)_lglw;
+   (void)_w;
+   (void)_h;
+   (void)_hotX;
+   (void)_hotY;
+   (void)_argb;
+
+   return NULL;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_cursor_destroy
+void lglw_cursor_destroy(lglw_t _lglw, lglw_cursor_t _cursor) {
+   (void)_lglw;
+   (void)_cursor;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_cursor_set
+void lglw_cursor_set(lglw_t _lglw, lglw_cursor_t _cursor) {
+   (void)_lglw;
+   (void)_cursor;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_motion_coalesce_set
+void lglw_mouse_motion_coalesce_set(lglw_t _lglw, lglw_bool_t _bEnable) {
+   (void)_lglw;
+   (void)_bEnable;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_mouse_motion_info_get
+uint32_t lglw_mouse_motion_info_get(lglw_t _lglw, int32_t *_retDX, int32_t *_retDY) {
+   (void)_lglw;
+
+   if(NULL != _retDX)
+      *_retDX = 0;
+
+   if(NULL != _retDY)
+      *_retDY = 0;
+
+   return 0u;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_timer_add
+uint32_t lglw_timer_add(lglw_t _lglw, uint64_t _intervalNS, lglw_timer_ex_fxn_t _cbk, void *_userData) {
+   (void)_lglw;
+   (void)_intervalNS;
+   (void)_cbk;
+   (void)_userData;
+
+   return 0u;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_timer_remove
+void lglw_timer_remove(lglw_t _lglw, uint32_t _timerId) {
+   (void)_lglw;
+   (void)_timerId;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_time_get_ns
+uint64_t lglw_time_get_ns(lglw_t _lglw) {
+   (void)_lglw;
+
+   return 0u;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_drag_begin
+lglw_bool_t lglw_drag_begin(lglw_t _lglw, const char **_mimeTypes, lglw_drag_provider_fxn_t _cbk) {
+   (void)_lglw;
+   (void)_mimeTypes;
+   (void)_cbk;
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_drag_cancel
+void lglw_drag_cancel(lglw_t _lglw) {
+   (void)_lglw;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_drag_is_active
+lglw_bool_t lglw_drag_is_active(lglw_t _lglw) {
+   (void)_lglw;
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_clipboard_provider_set
+lglw_bool_t lglw_clipboard_provider_set(lglw_t _lglw, const char **_mimeTypes, lglw_clipboard_provider_fxn_t _cbk) {
+   (void)_lglw;
+   (void)_mimeTypes;
+   (void)_cbk;
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_clipboard_request_async
+lglw_bool_t lglw_clipboard_request_async(lglw_t _lglw, const char *_mimeType, lglw_clipboard_fxn_t _cbk, uint64_t _timeoutNS) {
+   (void)_lglw;
+   (void)_mimeType;
+   (void)_cbk;
+   (void)_timeoutNS;
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_clipboard_request_cancel
+void lglw_clipboard_request_cancel(lglw_t _lglw) {
+   (void)_lglw;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_events_shared
+void lglw_events_shared(void) {
+}
+
+
+// ---------------------------------------------------------------------------- lglw_events_wait
+lglw_bool_t lglw_events_wait(lglw_t _lglw, uint64_t _timeoutNS) {
+   (void)_lglw;
+   (void)_timeoutNS;
+
+   return LGLW_FALSE;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_event_fd_get
+int lglw_event_fd_get(lglw_t _lglw) {
+   (void)_lglw;
+
+   return -1;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_events_queue_enable
+void lglw_events_queue_enable(lglw_t _lglw, lglw_bool_t _bEnable) {
+   (void)_lglw;
+   (void)_bEnable;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_events_poll
+uint32_t lglw_events_poll(lglw_t _lglw, lglw_event_t *_retEvents, uint32_t _maxEvents) {
+   (void)_lglw;
+   (void)_retEvents;
+   (void)_maxEvents;
+
+   return 0u;
+}
+
+
+// ---------------------------------------------------------------------------- lglw_event_time_get
+void lglw_event_time_get(lglw_t _lglw, uint32_t *_retServerTime, uint64_t *_retRecvNS) {
+   (void)_lglw;
+
+   if(NULL != _retServerTime)
+      *_retServerTime = 0u;
+
+   if(NULL != _retRecvNS)
+      *_retRecvNS = 0u;
+}